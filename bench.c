@@ -0,0 +1,235 @@
+#include <16F1825.h>
+#use delay(clock=32MHZ)    //clock de 32Mhz
+
+#FUSES INTRC_IO,NOWDT,PUT,NOMCLR,NOPROTECT,NOCPD,BROWNOUT_NOSL,NOCLKOUT,NOIESO,NOFCMEN,NOWRT,PLL_SW,NOSTVREN,BORV25,NODEBUG,NOLVP
+
+/* ------------------------------- BENCHMARK ----------------------------------
+ * Mide en el propio PIC los ciclos de instruccion que cuestan las funciones de
+ * color de la libreria para distintas cantidades de LEDs, desde 1 hasta
+ * PIX_NUM_LEDS. Los ciclos salen del Timer1 (modo PIX_PROFILE), no de un
+ * modelo, asi que son los reales del codigo generado por el compilador.
+ *
+ * El resultado se envia por la UART (115200 8N1, TX en RC4) en formato CSV
+ * para poder guardarlo y comparar entre versiones:
+ *
+ * op,leds,llamadas,ciclos_min,ciclos_max,ciclos_total,ciclos_pixel,ns_pixel
+ *
+ * ciclos_min/ciclos_max son por llamada. ciclos_pixel y ns_pixel dividen el
+ * total entre todos los pixels procesados. Cuando no aplica (Wheel no toca
+ * pixels) se divide entre las llamadas.
+ *
+ * Para compilarlo cambiar "source_file" a "bench" en .vscode/settings.json
+ * ---------------------------------------------------------------------------*/
+
+#use fast_io(a)               //se accede al puerto a como memoria
+#use rs232(baud=115200, xmit=PIN_C4, rcv=PIN_C5, ERRORS)
+
+//Bits					543210
+#define TRIS_A		0b00111110		//define cuales son entradas y cuales salidas
+
+#define PIX_PIN		PIN_A0		// O
+
+/* CONSTANTES PARA PIXEL LED */
+#define PIX_PROFILE					//necesario para medir ciclos
+#define PIX_PROF_EXTRA			4	//contadores propios del benchmark
+#define PIX_NUM_LEDS			85	//maximo, se miden todos los tamaños hasta aqui
+#define PIX_MATRIZ_ANCHO		9	//matriz de 9x9 (81 LEDs) para medir Blit
+#define PIX_MATRIZ_ALTO			9
+#define PIX_MATRIZ_SERPENTINA
+
+/* INCLUDES */
+#include "led_pixels.c"
+#include "led_pixels_ruido.c"
+#include "led_pixels_matriz.c"
+#include "led_pixels_sprite.c"
+#include "led_pixels_guion.c"
+
+/* CONSTANTES DEL BENCHMARK */
+#define BENCH_REPETICIONES		8	//veces que se repite cada medida
+
+//Contadores de lo que la libreria no mide, uno por operacion
+#define BENCH_PROF_GET			(PIX_PROF_LIB + 0)	//GetPixelColor
+#define BENCH_PROF_RUIDO		(PIX_PROF_LIB + 1)	//RuidoLinea
+#define BENCH_PROF_BLIT			(PIX_PROF_LIB + 2)	//Blit
+#define BENCH_PROF_GUION		(PIX_PROF_LIB + 3)	//PasoGuion
+
+//Cantidades de LEDs a medir. La ultima es siempre PIX_NUM_LEDS
+const int BenchLeds[] = {1, 2, 4, 8, 16, 32, 64, PIX_NUM_LEDS};
+#define BENCH_NUM_TAMANOS		(sizeof(BenchLeds) / sizeof(BenchLeds[0]))
+
+//Sprite de 8x8 opaco: Blit se mide por pixel opaco
+rom int BenchSprite[] = {
+	8, 8, 2,
+	255, 0, 0,
+	0, 0, 255,
+	1, 1, 1, 1, 2, 2, 2, 2,
+	1, 1, 1, 1, 2, 2, 2, 2,
+	1, 1, 1, 1, 2, 2, 2, 2,
+	1, 1, 1, 1, 2, 2, 2, 2,
+	2, 2, 2, 2, 1, 1, 1, 1,
+	2, 2, 2, 2, 1, 1, 1, 1,
+	2, 2, 2, 2, 1, 1, 1, 1,
+	2, 2, 2, 2, 1, 1, 1, 1
+};
+
+//Guion de 8 instrucciones PIXEL por fotograma, con el mismo color que la
+//medida de SetPixelColor32: la diferencia es lo que cuesta interpretarlas
+rom int BenchGuion[] = {
+	PIX_OP_PIXEL, 0, 0, 0xFF, 0x6A, 0x00,
+	PIX_OP_PIXEL, 1, 0, 0xFF, 0x6A, 0x00,
+	PIX_OP_PIXEL, 2, 0, 0xFF, 0x6A, 0x00,
+	PIX_OP_PIXEL, 3, 0, 0xFF, 0x6A, 0x00,
+	PIX_OP_PIXEL, 4, 0, 0xFF, 0x6A, 0x00,
+	PIX_OP_PIXEL, 5, 0, 0xFF, 0x6A, 0x00,
+	PIX_OP_PIXEL, 6, 0, 0xFF, 0x6A, 0x00,
+	PIX_OP_PIXEL, 7, 0, 0xFF, 0x6A, 0x00,
+	PIX_OP_ESPERAR, 1,
+	PIX_OP_SALTO, 0, 0
+};
+
+/*
+ * Imprime una linea CSV con el contador de perfilado (id)
+ * leds = tamaño medido, pixels = pixels procesados en total (para ns/pixel)
+ * Los ns salen de los ciclos al final, con 4000 / MHz ns por ciclo sin
+ * redondear (83,3 ns a 48MHz)
+ */
+void BenchLinea(int leds, int32 pixels, int id){
+int32 porPixel, ns;
+	PixPerfil *p = &PixPerfiles[id];
+
+	if(pixels == 0) pixels = p->Llamadas;
+	porPixel = p->Total / pixels;
+	ns = (porPixel * 4000 + PIX_MHZ / 2) / PIX_MHZ;
+
+	printf(",%u,%lu,%Lu,%Lu,%Lu,%Lu,%Lu\r\n", leds, p->Llamadas, p->Min,
+		p->Max, p->Total, porPixel, ns);
+}
+
+void main(void) {
+int n, leds, rep, pos;
+int32 c;
+int Ruido[PIX_NUM_LEDS];
+
+	setup_oscillator(OSC_8MHZ|OSC_PLL_ON);	//configura oscilador interno
+	setup_wdt(WDT_OFF);						//configuracion wdt
+	setup_adc(ADC_OFF);						//configura ADC
+	setup_comparator(NC_NC_NC_NC);			//comparador apagado
+	set_tris_a(TRIS_A);						//configura I/O
+
+	InitPixels();	//inicializa pixels y Timer1
+
+	printf("op,leds,llamadas,ciclos_min,ciclos_max,ciclos_total,ciclos_pixel,ns_pixel\r\n");
+
+	for(n = 0; n < BENCH_NUM_TAMANOS; n++){
+		leds = BenchLeds[n];
+
+		//SetPixelColor(n, r, g, b)
+		PixPerfilReiniciar();
+		for(rep = 0; rep < BENCH_REPETICIONES; rep++){
+			for(pos = 0; pos < leds; pos++){
+				SetPixelColor(pos, rep, pos, 0x55);
+			}
+		}
+		printf("SetPixelColorRGB");
+		BenchLinea(leds, (int32)leds * BENCH_REPETICIONES, PIX_PROF_SET);
+
+		//SetPixelColor(n, c)
+		PixPerfilReiniciar();
+		for(rep = 0; rep < BENCH_REPETICIONES; rep++){
+			for(pos = 0; pos < leds; pos++){
+				SetPixelColor(pos, PIX_NARANJA);
+			}
+		}
+		printf("SetPixelColor32");
+		BenchLinea(leds, (int32)leds * BENCH_REPETICIONES, PIX_PROF_SET);
+
+		//LlenarDeColor(0, leds-1, c)
+		PixPerfilReiniciar();
+		for(rep = 0; rep < BENCH_REPETICIONES; rep++){
+			LlenarDeColor(0, leds-1, PIX_CELESTE);
+		}
+		printf("LlenarDeColor");
+		BenchLinea(leds, (int32)leds * BENCH_REPETICIONES, PIX_PROF_LLENAR);
+
+		//GetPixelColor no esta instrumentada, se mide aqui con su propio contador
+		PixPerfilReiniciar();
+		for(rep = 0; rep < BENCH_REPETICIONES; rep++){
+			PIX_PROF_INICIO(PixT);
+			for(pos = 0; pos < leds; pos++){
+				c = GetPixelColor(pos);
+			}
+			PIX_PROF_FIN(PixT, BENCH_PROF_GET);
+		}
+		printf("GetPixelColor");
+		BenchLinea(leds, (int32)leds * BENCH_REPETICIONES, BENCH_PROF_GET);
+
+		//RuidoLinea: ruido 2D por la tira, con cambios de celda cada pocos LEDs
+		PixPerfilReiniciar();
+		for(rep = 0; rep < BENCH_REPETICIONES; rep++){
+			PIX_PROF_INICIO(PixT);
+			RuidoLinea(Ruido, leds, (long)rep << 9, 40, (long)rep * 37);
+			PIX_PROF_FIN(PixT, BENCH_PROF_RUIDO);
+		}
+		printf("RuidoLinea");
+		BenchLinea(leds, (int32)leds * BENCH_REPETICIONES, BENCH_PROF_RUIDO);
+	}
+
+	//Wheel no depende del numero de LEDs: se recorre la rueda completa
+	PixPerfilReiniciar();
+	pos = 0;
+	do{
+		c = Wheel(pos);
+	}while(++pos != 0);
+	printf("Wheel");
+	BenchLinea(0, 0, PIX_PROF_WHEEL);
+
+	//Blit del sprite de 8x8 en la matriz de 9x9: filas pares seguidas en el
+	//buffer (autoincremento) e impares al reves (paso de la serpentina)
+	PixPerfilReiniciar();
+	for(rep = 0; rep < BENCH_REPETICIONES; rep++){
+		PIX_PROF_INICIO(PixT);
+		Blit(BenchSprite, rep & 1, 0);
+		PIX_PROF_FIN(PixT, BENCH_PROF_BLIT);
+	}
+	printf("Blit");
+	BenchLinea(64, 64 * BENCH_REPETICIONES, BENCH_PROF_BLIT);
+
+	//PasoGuion con 8 PIXEL por fotograma. Las medidas de los SetPixelColor
+	//de dentro no suman su propio coste a esta
+	IniciarGuion(BenchGuion);
+	PixPerfilReiniciar();
+	for(rep = 0; rep < BENCH_REPETICIONES; rep++){
+		PIX_PROF_INICIO(PixT);
+		PasoGuion();
+		PIX_PROF_FIN(PixT, BENCH_PROF_GUION);
+	}
+	printf("Guion");
+	BenchLinea(8, 8 * BENCH_REPETICIONES, BENCH_PROF_GUION);
+
+	//CambiarBrillo siempre recorre los PIX_NUM_BYTES del buffer.
+	//Barrido de subida y bajada para incluir los dos sentidos de escala
+	LlenarDeColor(0, PIX_NUM_LEDS-1, PIX_BLANCO);
+	PixPerfilReiniciar();
+	for(pos = 255; pos > 0; pos -= 15){
+		CambiarBrillo(pos);
+	}
+	for(pos = 0; pos < 255; pos += 15){
+		CambiarBrillo(pos);
+	}
+	printf("CambiarBrillo");
+	BenchLinea(PIX_NUM_LEDS, (int32)PIX_NUM_LEDS * PixPerfiles[PIX_PROF_BRILLO].Llamadas, PIX_PROF_BRILLO);
+
+	//MostrarPixels, y por separado el tiempo con interrupciones desactivadas
+	PixPerfilReiniciar();
+	for(rep = 0; rep < BENCH_REPETICIONES; rep++){
+		MostrarPixels();
+	}
+	printf("MostrarPixels");
+	BenchLinea(PIX_NUM_LEDS, (int32)PIX_NUM_LEDS * BENCH_REPETICIONES, PIX_PROF_MOSTRAR);
+	printf("IrqOff");
+	BenchLinea(PIX_NUM_LEDS, (int32)PIX_NUM_LEDS * BENCH_REPETICIONES, PIX_PROF_IRQOFF);
+
+	printf("fin\r\n");
+
+	while(true);
+}
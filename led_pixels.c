@@ -3,28 +3,132 @@
 /*
  * Inicializa la librería:
  * - Configura Timer2 si es necesario (para el reset de 50us)
- * - Pone el pin de datos en LOW
+ * - Pone el pin de datos en LOW (o configura el SPI para APA102/SK9822)
  * - Limpia el buffer de pixels (todos en negro)
  */
 void InitPixels(void){
+#ifdef PIX_LUT
+	#ifdef PIX_LUT_EEPROM
+	//factores guardados en EEPROM; si esta borrada (0xFF) se quedan los de compilacion
+	if((read_eeprom(PIX_LUT_EEPROM) & read_eeprom(PIX_LUT_EEPROM + 1) & read_eeprom(PIX_LUT_EEPROM + 2)) != 0xFF){
+		PixBalance[0] = read_eeprom(PIX_LUT_EEPROM);
+		PixBalance[1] = read_eeprom(PIX_LUT_EEPROM + 1);
+		PixBalance[2] = read_eeprom(PIX_LUT_EEPROM + 2);
+	}
+	#endif
+	PixLUTCalcular();		//antes de escribir nada en el buffer
+#endif
+
 	//Configura timer para desbordar cada 50uS, pero no genera interrupcion
 #ifdef PIX_DELAY_TIMER2
-	#if getenv("CLOCK") == 48000000
+	#if getenv("CLOCK") == 64000000
+		// Para 64 MHz: 64/4 = 16, divisor 4 → 4MHz, 4MHz*50us=200-1=199
+		setup_timer_2(T2_DIV_BY_4, 199, 1);
+	#elif getenv("CLOCK") == 48000000
 		// Para 48 MHz: 48/4 = 12, divisor 4 → 3MHz, 3MHz*50us=150-1=149
 		setup_timer_2(T2_DIV_BY_4, 149, 1);
+	#elif getenv("CLOCK") == 40000000
+		// Para 40 MHz: 40/4 = 10, divisor 4 → 2.5MHz, 2.5MHz*50us=125-1=124
+		setup_timer_2(T2_DIV_BY_4, 124, 1);
 	#elif getenv("CLOCK") == 32000000
 		// Para 32 MHz: 32/4 = 8, divisor 4 → 2MHz, 2MHz*50us=100-1=99
 		setup_timer_2(T2_DIV_BY_4, 99, 1);
 	#elif getenv("CLOCK") == 24000000
 		// Para 24 MHz: 24/4 = 6, divisor 4 → 1.5MHz, 1.5MHz*50us=75-1=74
 		setup_timer_2(T2_DIV_BY_4, 74, 1);
+	#elif getenv("CLOCK") == 20000000
+		// Para 20 MHz: 20/4 = 5, divisor 4 → 1.25MHz, 1.25MHz*50us=62.5 → 63-1=62
+		setup_timer_2(T2_DIV_BY_4, 62, 1);
 	#elif getenv("CLOCK") == 16000000
 		// Para 16 MHz: 16/4 = 4, divisor 4 → 1MHz, 1MHz*50us=50-1=49
 		setup_timer_2(T2_DIV_BY_4, 49, 1);
 	#endif
 	disable_interrupts(INT_TIMER2);
 #endif
+#ifdef PIX_PROFILE
+	//Timer1 libre a Fosc/4, cada cuenta es un ciclo de instruccion (o PIX_PROFILE_DIV)
+	setup_timer_1(T1_INTERNAL | PIX_PROF_T1);
+	TMR1IF = 0;
+	PixPerfilReiniciar();
+#endif
+#ifdef PIX_APA102
+	//SPI modo 0: los APA102/SK9822 leen el dato en el flanco de subida
+	setup_spi(SPI_MASTER | SPI_L_TO_H | SPI_XMIT_L_TO_H | PIX_SPI_DIV);
+#elif defined(PIX_DMA)
+	//TMR2: un periodo = medio bit. El CCP1 da el pulso de T0H al empezar cada periodo
+	setup_timer_2(T2_CLK_INTERNAL | T2_DIV_BY_1, PIX_DMA_PR2, 1);
+	setup_ccp1(CCP_PWM);
+	set_pwm1_duty((long)PIX_DMA_PWM);
+	
+	//SPI1 maestro, solo transmision, reloj = TMR2 / 2 (un bit WS2812 por bit SPI).
+	//CKP=0: SCK en reposo bajo. CKE=0: SDO cambia en cada flanco de subida de
+	//SCK y se mantiene hasta la siguiente subida, un periodo completo de SCK
+	SPI1CON0 = 0;
+	SPI1CON1 = 0x00;			//SMP=0, CKE=0, CKP=0
+	SPI1CON2 = 0x02;			//TXR=1, RXR=0
+	SPI1CLK = PIX_SPI_CLK_TMR2;
+	SPI1BAUD = 0;
+	SPI1CON0 = 0x83;			//EN, MSB primero, MST, BMODE
+	
+	//CLC1 en modo AND-OR: salida = (SCK & SDO) | (SCK & PWM)
+	CLCSELECT = 0;
+	CLCnCON = 0;
+	CLCnPOL = 0;
+	CLCnSEL0 = PIX_CLC_SEL_SCK;	//d1
+	CLCnSEL1 = PIX_CLC_SEL_SDO;	//d2
+	CLCnSEL2 = PIX_CLC_SEL_PWM;	//d3
+	CLCnSEL3 = PIX_CLC_SEL_SCK;	//d4 sin usar
+	CLCnGLS0 = 0x02;			//puerta 1 = d1
+	CLCnGLS1 = 0x08;			//puerta 2 = d2
+	CLCnGLS2 = 0x02;			//puerta 3 = d1
+	CLCnGLS3 = 0x20;			//puerta 4 = d3
+	CLCnCON = 0x80;				//EN, modo AND-OR
+	
+	//DMA1: Pixels[] (incrementa) -> SPI1TXB (fijo), un byte por peticion SPI1TX.
+	//SSTP: al acabar el origen se desactiva el disparo y salta INT_DMA1SCNT
+	DMASELECT = 0;
+	DMAnCON0 = 0;
+	DMAnCON1 = 0x03;			//DMODE=00, SMR=00, SMODE=01, SSTP=1
+	DMAnSSAU = 0;
+	DMAnSSA = Pixels;
+	DMAnSSZ = PIX_NUM_BYTES;
+	DMAnDSA = getenv("SFR:SPI1TXB");
+	DMAnDSZ = 1;
+	DMAnSIRQ = PIX_DMA_SIRQ_SPITX;
+	DMAnAIRQ = 0;
+	
+	//El DMA solo tiene acceso al bus con las prioridades bloqueadas. La
+	//secuencia 0x55, 0xAA, PRLOCKED tienen que ser estas instrucciones seguidas
+	//y sin interrupciones (hoja de datos), asi que va en ensamblador: en C el
+	//compilador puede meter otras instrucciones entre las escrituras
+	short GIEval = GIE;
+	DMA1PR = 0;
+	GIE = 0;
+	#asm
+		MOVLW	0x55
+		MOVWF	PRLOCK
+		MOVLW	0xAA
+		MOVWF	PRLOCK
+		BSF		PRLOCK, 0		; PRLOCKED = 1
+	#endasm
+	GIE = GIEval;
+	
+	//Timer 4 de un disparo para el reset: Fosc/4, divisor 16, arranque por software
+	T4CLKCON = 0x01;
+	T4HLT = 0x08;
+	T4PR = PIX_DMA_PR4;
+	T4CON = 0x40;
+	
+	enable_interrupts(INT_DMA1SCNT);
+	enable_interrupts(INT_TIMER4);
+	output_low(PIX_PIN);
+#else
 	output_low(PIX_PIN);
+#endif
+#ifdef PIX_POWER_PIN
+	PIX_POWER_ON();		//el primer MostrarPixels() envia negro y la vuelve a apagar
+	delay_us(PIX_POWER_US);
+#endif
 	LlenarDeColor(0, PIX_NUM_LEDS-1, PIX_NEGRO); //pone todos los pixels en negro
 }
 
@@ -32,22 +136,26 @@ void InitPixels(void){
  * Escribe el color RGB en el LED n
  * Parámetros: n = índice, r/g/b = componentes de color
  */
-void SetPixelColor(int n, int r, int g, int b){
+void SetPixelColor(PixIndice n, int r, int g, int b){
+	PIX_PROF_INICIO(PixT);
+	
 	if(n < PIX_NUM_LEDS){
-		if(Brillo != 0){ //Mirar notas en SetBrightness()
-			r = ((long)r * Brillo) >> 8;
-			g = ((long)g * Brillo) >> 8;
-			b = ((long)b * Brillo) >> 8;
-		}
+		PIX_AJUSTAR(r, g, b);	//brillo (y balance con PIX_LUT). Mirar notas en CambiarBrillo()
 		
 		int * p;
 		p = &Pixels[n * 3];
+		PIX_CAMBIO_PIXEL(n, p, r, g, b);
 		
 #ifdef PIX_RGB
 		//para led RGB
 		*p++ = r;
 		*p++ = g;
 		*p = b;
+#elif defined(PIX_BGR)
+		//para leds APA102/SK9822
+		*p++ = b;
+		*p++ = g;
+		*p = r;
 #else
 		//para leds GRB
 		*p++ = g;
@@ -55,32 +163,38 @@ void SetPixelColor(int n, int r, int g, int b){
 		*p = b;
 #endif
 	}
+	
+	PIX_PROF_FIN(PixT, PIX_PROF_SET);
 }
 
 /*
  * Escribe el color en el LED n usando un int32 (formato RGB)
  * Parámetros: n = índice, c = color empaquetado
  */
-void SetPixelColor(int n, int32 c){
+void SetPixelColor(PixIndice n, int32 c){
+	PIX_PROF_INICIO(PixT);
+	
 	if(n < PIX_NUM_LEDS){
 		int r = (int)(c >> 16);
 		int g = (int)(c >>  8);
 		int b = (int)c;
 		
-		if(Brillo != 0){ //Mirar notas en SetBrightness()
-			r = ((long)r * Brillo) >> 8;
-			g = ((long)g * Brillo) >> 8;
-			b = ((long)b * Brillo) >> 8;
-		}
+		PIX_AJUSTAR(r, g, b);	//brillo (y balance con PIX_LUT). Mirar notas en CambiarBrillo()
 		
 		int * p;
 		p = &Pixels[n * 3];
+		PIX_CAMBIO_PIXEL(n, p, r, g, b);
 		
 #ifdef PIX_RGB
 		//para led RGB
 		*p++ = r;
 		*p++ = g;
 		*p = b;
+#elif defined(PIX_BGR)
+		//para leds APA102/SK9822
+		*p++ = b;
+		*p++ = g;
+		*p = r;
 #else
 		//para leds GRB
 		*p++ = g;
@@ -88,6 +202,8 @@ void SetPixelColor(int n, int32 c){
 		*p = b;
 #endif
 	}
+	
+	PIX_PROF_FIN(PixT, PIX_PROF_SET);
 }
 
 /*
@@ -102,30 +218,39 @@ int32 Color32(int r, int g, int b){
  * Útil para efectos arcoiris y barridos de color
  */
 int32 Wheel(int WheelPos){
+int32 c;
+	PIX_PROF_INICIO(PixT);
+	
 	if(WheelPos < 85){
-		return Color32(255-WheelPos*3,WheelPos*3,0);
+		c = Color32(255-WheelPos*3,WheelPos*3,0);
 	}else if(WheelPos < 170){
 		WheelPos -= 85;
-		return Color32(0,255-WheelPos*3,WheelPos*3);
+		c = Color32(0,255-WheelPos*3,WheelPos*3);
 	}else{
 		WheelPos -= 170;
-		return Color32(WheelPos*3,0,255-WheelPos*3);
+		c = Color32(WheelPos*3,0,255-WheelPos*3);
 	}
+	
+	PIX_PROF_FIN(PixT, PIX_PROF_WHEEL);
+	return c;
 }
 
 /*
  * Lee el color actual del LED n (formato int32 RGB)
  */
-int32 GetPixelColor(int n){
+int32 GetPixelColor(PixIndice n){
 	if(n < PIX_NUM_LEDS) {
-		int ofs = n * 3;
+		PixNumByte ofs = n * 3;
 		
 #ifdef PIX_RGB
 		//para led RGB
-		return (int32)((Pixels[ofs] << 16) | (Pixels[ofs + 1] <<  8) | (Pixels[ofs + 2]));
+		return make32(0, Pixels[ofs], Pixels[ofs + 1], Pixels[ofs + 2]);
+#elif defined(PIX_BGR)
+		//para leds APA102/SK9822
+		return make32(0, Pixels[ofs + 2], Pixels[ofs + 1], Pixels[ofs]);
 #else
 		//para leds GRB
-		return (int32)((Pixels[ofs + 1] <<  8) | (Pixels[ofs] << 16) | (Pixels[ofs + 2]));
+		return make32(0, Pixels[ofs + 1], Pixels[ofs], Pixels[ofs + 2]);
 #endif
 		
 	}
@@ -133,6 +258,46 @@ int32 GetPixelColor(int n){
   return 0; //pixel fuera de limites
 }
 
+/*
+ * Tabla de inversos para CambiarBrillo(), evita dividir en tiempo de ejecucion
+ * PixInverso[k] = 65536 / k, con k = valor almacenado en Brillo (0 equivale
+ * a 256, maximo brillo). Para k = 1 (apagado) no se usa: todo el buffer es 0
+ */
+const long PixInverso[256] = {
+	  256,     0, 32768, 21845, 16384, 13107, 10923,  9362,	//0-7
+	 8192,  7282,  6554,  5958,  5461,  5041,  4681,  4369,	//8-15
+	 4096,  3855,  3641,  3449,  3277,  3121,  2979,  2849,	//16-23
+	 2731,  2621,  2521,  2427,  2341,  2260,  2185,  2114,	//24-31
+	 2048,  1986,  1928,  1872,  1820,  1771,  1725,  1680,	//32-39
+	 1638,  1598,  1560,  1524,  1489,  1456,  1425,  1394,	//40-47
+	 1365,  1337,  1311,  1285,  1260,  1237,  1214,  1192,	//48-55
+	 1170,  1150,  1130,  1111,  1092,  1074,  1057,  1040,	//56-63
+	 1024,  1008,   993,   978,   964,   950,   936,   923,	//64-71
+	  910,   898,   886,   874,   862,   851,   840,   830,	//72-79
+	  819,   809,   799,   790,   780,   771,   762,   753,	//80-87
+	  745,   736,   728,   720,   712,   705,   697,   690,	//88-95
+	  683,   676,   669,   662,   655,   649,   643,   636,	//96-103
+	  630,   624,   618,   612,   607,   601,   596,   590,	//104-111
+	  585,   580,   575,   570,   565,   560,   555,   551,	//112-119
+	  546,   542,   537,   533,   529,   524,   520,   516,	//120-127
+	  512,   508,   504,   500,   496,   493,   489,   485,	//128-135
+	  482,   478,   475,   471,   468,   465,   462,   458,	//136-143
+	  455,   452,   449,   446,   443,   440,   437,   434,	//144-151
+	  431,   428,   426,   423,   420,   417,   415,   412,	//152-159
+	  410,   407,   405,   402,   400,   397,   395,   392,	//160-167
+	  390,   388,   386,   383,   381,   379,   377,   374,	//168-175
+	  372,   370,   368,   366,   364,   362,   360,   358,	//176-183
+	  356,   354,   352,   350,   349,   347,   345,   343,	//184-191
+	  341,   340,   338,   336,   334,   333,   331,   329,	//192-199
+	  328,   326,   324,   323,   321,   320,   318,   317,	//200-207
+	  315,   314,   312,   311,   309,   308,   306,   305,	//208-215
+	  303,   302,   301,   299,   298,   297,   295,   294,	//216-223
+	  293,   291,   290,   289,   287,   286,   285,   284,	//224-231
+	  282,   281,   280,   279,   278,   277,   275,   274,	//232-239
+	  273,   272,   271,   270,   269,   267,   266,   265,	//240-247
+	  264,   263,   262,   261,   260,   259,   258,   257	//248-255
+};
+
 /*
  * Ajusta el brillo de TODOS los leds
  * 0 = completamente apagado, 255 = completamente encendido
@@ -155,32 +320,305 @@ int32 GetPixelColor(int n){
  * El valor de brillo almacenado es diferente al valor asignado. De esta manera
  * se optimizan las instrucciones de escalado. La variable "brightness" es un INT.
  * 0 = maximo brillo, 1 = minimo brillo (off), 255 = uno menos a maximo brillo.
+ * 
+ * El factor real de cada brillo es (b+1)/256, asi que para pasar del brillo
+ * anterior al nuevo se multiplica cada byte por Nuevo/Anterior. Ese cociente
+ * se calcula una sola vez como Nuevo * PixInverso[Anterior] en formato 8.16
+ * (sin division) y cada byte se escala con tres multiplicaciones de 8x8 bits.
+ * El error de cada llamada es menor de 1 bit respecto al escalado ideal y
+ * el resultado se satura a 255 en lugar de desbordar.
  */
 void CambiarBrillo(int b){
+	PIX_PROF_INICIO(PixT);
+#ifdef PIX_APA102
+	//APA102/SK9822: el brillo va en la cabecera de cada LED, el buffer no se toca
+	//y no hay perdida de resolucion. 0-255 se reduce a los 5 bits del LED
+	PixBrillo5 = b >> 3;
+#else
 	int NuevoBrillo = b + 1;
 	
 	//solo cambiamos el brillo si el nuevo valor es diferente al antiguo
 	if(NuevoBrillo != Brillo){
-		int Val;							//valor de color, solo es una parte del R/G/B
-		int *ptr = Pixels;					//puntero a el array de pixels
-		int BrilloAnterior = Brillo - 1;	//brillo anterior (real, de 0 a 255)
-		long Escala;						//escala, se multiplicn todos los valores por esta escala
-		
-		if(BrilloAnterior == 0)
-			Escala = 0;						//evitamos division entre 0
-		else if (b == 255)
-			Escala = 65535 / BrilloAnterior;
-		else 
-			Escala = (((long)NuevoBrillo << 8) - 1) / BrilloAnterior;
-		
-		for(int i=0; i<PIX_NUM_BYTES; i++) {
-			Val = *ptr;
-			*ptr = (Val * Escala) >> 8;
-			*ptr++;
-		}
-		
+		PixEscalarBuffer(Pixels, PIX_NUM_BYTES, Brillo, NuevoBrillo);
 		Brillo = NuevoBrillo;
+		PIX_BUFFER_TOCADO();
+#ifdef PIX_LUT
+		PixLUTCalcular();	//el brillo va dentro de las tablas
+#endif
+	}
+#endif
+	
+	PIX_PROF_FIN(PixT, PIX_PROF_BRILLO);
+}
+
+/*
+ * Multiplica (Bytes) bytes desde (ptr) por Nuevo/Anterior, con los valores
+ * de brillo en el formato de la variable Brillo (0 = 256). Lo usan
+ * CambiarBrillo() y el brillo de cada tira (led_pixels_tiras.c)
+ */
+void PixEscalarBuffer(int *ptr, long Bytes, int Anterior, int Nuevo){
+int32 Escala;						//escala en formato 8.16, se multiplican todos los valores por esta escala
+int E2, E1, E0;						//bytes de la escala (entero, fraccion alta, fraccion baja)
+long Val;
+	
+	if((Anterior == 0) && (Nuevo != 0)){
+		//desde el maximo (el caso normal) es solo multiplicar por Nuevo/256
+		PixEscalarBytes(ptr, Bytes, Nuevo);
+		return;
 	}
+	
+	if(Anterior == 1){
+		Escala = 0;						//estaba apagado: todo el buffer ya es 0
+	}else{
+		//Nuevo = 0 representa 256 (maximo brillo)
+		if(Nuevo == 0)
+			Escala = (int32)PixInverso[Anterior] << 8;
+		else
+			Escala = _mul(PixInverso[Anterior], Nuevo);
+	}
+	
+	E2 = make8(Escala, 2);
+	E1 = make8(Escala, 1);
+	E0 = make8(Escala, 0);
+	
+	while(Bytes--){
+		//Val = (*ptr * Escala + 0x8000) >> 16, sin pasar por 32 bits
+		Val = _mul(*ptr, E1) + make8(_mul(*ptr, E0), 1) + 0x80;
+		Val = _mul(*ptr, E2) + make8(Val, 1);
+		
+		if(Val > 255)
+			*ptr = 255;						//saturo en lugar de desbordar
+		else
+			*ptr = Val;
+		ptr++;
+	}
+}
+
+/*
+ * MATEMATICA DE 8 BITS
+ * Operaciones de 8 bits para escalar y mezclar colores (equivalen a scale8,
+ * qadd8, qsub8, blend8, nscale8 y fadeToBlackBy de FastLED). En PIC16 no hay
+ * multiplicador y _mul() llama a una rutina con bucle; aqui la multiplicacion
+ * va desenrollada en ensamblador sobre los 8 bits de la escala (suma y
+ * desplaza), con tiempo fijo. En PIC18 se usa MULWF.
+ * 
+ * Ciclos de instruccion (sin la llamada):
+ *   Escalar8		PIC16: 36		PIC18: 3
+ *   Sumar8/Restar8	5
+ *   Mezclar8		PIC16: ~45		PIC18: ~12
+ *   PixEscalarBytes	PIC16: 44/byte	PIC18: ~8/byte
+ */
+
+/*
+ * Devuelve (v * s) / 256, redondeado hacia abajo
+ */
+#ifdef __PCH__
+#inline
+#endif
+int Escalar8(int v, int s){
+#ifdef __PCH__
+	return make8(_mul(v, s), 1);	//MULWF
+#else
+int h, l;	//producto de 16 bits; solo se usa el byte alto
+	#asm
+		CLRF	h
+		CLRF	l				; l empieza a 0: sus 8 RRF sacan siempre C = 0
+		MOVF	v, W
+		BCF		STATUS, 0
+		BTFSC	s, 0			; bit 0 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 1			; bit 1 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 2			; bit 2 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 3			; bit 3 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 4			; bit 4 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 5			; bit 5 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 6			; bit 6 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 7			; bit 7 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+	#endasm
+	return h;
+#endif
+}
+
+/*
+ * Devuelve a + b, saturado a 255
+ */
+int Sumar8(int a, int b){
+	#asm
+		MOVF	a, W
+		ADDWF	b, W
+		BTFSC	STATUS, 0		; si hay acarreo
+		MOVLW	0xFF			; satura
+		MOVWF	a
+	#endasm
+	return a;
+}
+
+/*
+ * Devuelve a - b, saturado a 0
+ */
+int Restar8(int a, int b){
+	#asm
+		MOVF	b, W
+		SUBWF	a, W			; W = a - b, C = 0 si hay prestamo
+		BTFSS	STATUS, 0
+		MOVLW	0				; satura
+		MOVWF	a
+	#endasm
+	return a;
+}
+
+/*
+ * Mezcla lineal: t = 0 devuelve a, t = 255 practicamente b
+ * Se escala la diferencia, asi que basta una multiplicacion
+ */
+int Mezclar8(int a, int b, int t){
+	if(b >= a) return a + Escalar8(b - a, t);
+	return a - Escalar8(a - b, t);
+}
+
+/*
+ * Multiplica (Bytes) bytes desde (ptr) por s / 256, recorriendolos con FSR0
+ * No toca PixSumaColor ni llama a PIX_BUFFER_TOCADO(): lo hace quien la usa
+ */
+void PixEscalarBytes(int *ptr, long Bytes, int s){
+	if(Bytes == 0) return;
+	
+#ifdef __PCH__
+	FSR0L = make8(ptr, 0);
+	FSR0H = make8(ptr, 1);
+	int v;
+	while(Bytes--){
+		v = INDF0;
+		POSTINC0 = make8(_mul(v, s), 1);	//MULWF s, MOVFF PRODH, POSTINC0
+	}
+#else
+int h, l;
+int nl, nh;	//contador como en MostrarPixels(): nl bytes y nh vueltas de 256
+	
+	nl = make8(Bytes, 0);
+	nh = make8(Bytes, 1);
+	if(nl != 0) nh++;
+	
+	FSR0L = make8(ptr, 0);
+	FSR0H = make8(ptr, 1);
+	
+	#asm
+	PixEscByte:
+		MOVF	INDF0, W
+		CLRF	h
+		CLRF	l
+		BCF		STATUS, 0
+		BTFSC	s, 0			; bit 0 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 1			; bit 1 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 2			; bit 2 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 3			; bit 3 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 4			; bit 4 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 5			; bit 5 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 6			; bit 6 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		BTFSC	s, 7			; bit 7 de la escala
+		ADDWF	h, F			; h += v (C = acarreo)
+		RRF		h, F
+		RRF		l, F			; C = 0 para el siguiente bit
+		MOVF	h, W
+		MOVWF	INDF0
+		INCF	FSR0L, F
+		BTFSC	STATUS, 2		; paso de pagina
+		INCF	FSR0H, F
+		DECFSZ	nl, F
+		GOTO	PixEscByte
+		DECFSZ	nh, F
+		GOTO	PixEscByte
+	#endasm
+#endif
+}
+
+/*
+ * Multiplica todo el buffer por Escala / 256 (0 = apagar)
+ */
+void AtenuarPixels(int Escala){
+	PixEscalarBytes(Pixels, PIX_NUM_BYTES, Escala);
+	PIX_BUFFER_TOCADO();
+}
+
+/*
+ * Baja todos los LEDs hacia negro en Cantidad / 256. Llamada en cada
+ * fotograma deja una estela que se apaga poco a poco
+ */
+void FundirANegro(int Cantidad){
+	if(Cantidad == 0) return;
+	PixEscalarBytes(Pixels, PIX_NUM_BYTES, 0 - Cantidad);	//256 - Cantidad
+	PIX_BUFFER_TOCADO();
+}
+
+/*
+ * Deja en Col[] los 3 bytes del color (c) como van en el buffer: ajustados
+ * (PIX_AJUSTAR) y en el orden de los LEDs
+ */
+void PixPrepararColor(int32 c, int *Col){
+int r, g, b;
+
+	r = make8(c, 2);
+	g = make8(c, 1);
+	b = make8(c, 0);
+
+	PIX_AJUSTAR(r, g, b);
+
+#ifdef PIX_RGB
+	Col[0] = r;
+	Col[1] = g;
+#elif defined(PIX_BGR)
+	Col[0] = b;
+	Col[1] = g;
+	b = r;
+#else
+	Col[0] = g;
+	Col[1] = r;
+#endif
+	Col[2] = b;
 }
 
 /*
@@ -188,34 +626,142 @@ void CambiarBrillo(int b){
  * Parámetros: from = primer LED, to = último LED, c = color (int32 RGB)
  * No actualiza los LEDs hasta llamar a MostrarPixels()
  */
-void LlenarDeColor(int from, int to, int32 c){
-int i;
+void LlenarDeColor(PixIndice from, PixIndice to, int32 c){
+PixIndice i;
+	PIX_PROF_INICIO(PixT);
 	
 	for(i = from; i<=to; i++){
 		SetPixelColor(i, c);
 	}
+	
+	PIX_PROF_FIN(PixT, PIX_PROF_LLENAR);
 }
 
 /*
  * Envía el buffer de colores por el pin de datos
- * Deshabilita interrupciones durante la transmisión
+ * Deshabilita interrupciones durante la transmisión (salvo con PIX_APA102)
+ * Con PIX_DMA solo arranca el envio y vuelve (mirar PixEnviando)
  * Rutinas de transmisión:
- *   - 400KHz disponible en 16, 24, 32 y 48MHz (principalmente para WS2811)
- *   - 800KHz solo en 32/48MHz (recomendado para WS2812/WS2812B)
+ *   - 400KHz disponible en 16, 20, 24, 32, 40, 48 y 64MHz (principalmente para WS2811)
+ *   - 800KHz en 32/40/48/64MHz (recomendado para WS2812/WS2812B), 625KHz a 20MHz
  *   - WS2812/WS2812B pueden no funcionar correctamente a 400KHz
  */
 void MostrarPixels(void){
+#ifdef PIX_PREFIJO
+	MostrarPixelsHasta(PixTope);	//hasta el ultimo LED escrito
+#else
+	MostrarPixelsHasta(PIX_NUM_LEDS);
+#endif
+}
+
+/*
+ * Envía solo los primeros LEDs: los WS281x que no reciben datos mantienen el
+ * color que tenian. La trama es mas corta pero el reset de 50uS es el mismo
+ * Parámetros: Leds = LEDs a enviar (se limita a PIX_NUM_LEDS)
+ */
+void MostrarPixelsHasta(PixIndice Leds){
 short GIEval;		//Valor de GIE
 int i;				//Loop
+long Bytes;			//Bytes a enviar
+	PIX_PROF_INICIO(PixT);
 
+	if(Leds > PIX_NUM_LEDS) Leds = PIX_NUM_LEDS;
+
+#ifdef PIX_DMA
+	while(PixEnviando){delay_cycles(1);}	//trama anterior y su reset de 50uS
+#endif
+
+#ifdef PIX_MAX_MA
+	//antes de deshabilitar interrupciones. Si escala el buffer cambia toda la tira
+	if(PixLimitarConsumo()) Leds = PIX_NUM_LEDS;
+#endif
+
+#ifdef PIX_AHORRO
+	if(PixEncendidosValido == FALSE) PixContarEncendidos();
+	
+	if(PixEncendidos == 0){
+		if(PixApagada){
+			PIX_PROF_FIN(PixT, PIX_PROF_MOSTRAR);
+			return;		//la tira ya recibio la trama negra: no se envia nada
+		}
+	}else if(PixApagada){
+	#ifdef PIX_POWER_PIN
+		PIX_POWER_ON();
+		delay_us(PIX_POWER_US);	//a que arranquen los LEDs antes de la trama
+		Leds = PIX_NUM_LEDS;	//sin alimentacion han perdido el color
+	#endif
+		PixApagada = FALSE;
+	}
+#endif
+
+#ifdef PIX_PREFIJO
+	if(Leds >= PixTope) PixTope = 0;	//no queda nada escrito sin enviar
+#endif
+#ifdef PIX_APA102
+	//siempre la tira entera: el brillo de CambiarBrillo() va en la cabecera
+	//de cada LED y no marca nada en el buffer
+	Leds = PIX_NUM_LEDS;
+#endif
+	if(Leds == 0){
+		PIX_PROF_FIN(PixT, PIX_PROF_MOSTRAR);
+		return;		//la tira ya tiene lo que hay en el buffer
+	}
+	Bytes = (long)Leds * 3;
+
+#ifdef PIX_APA102
+// ==================== ENVIO DE DATOS APA102/SK9822 ====================
+//Por el MSSP en modo SPI, sin desactivar interrupciones. Trama de inicio,
+//cabecera y B, G, R de cada LED y trama de fin (led_pixels_apa102.h)
+#include "led_pixels_apa102.c"
+#elif defined(PIX_DMA)
+// ================ ENVIO DE DATOS POR DMA (PIC18 Q43/Q84) ================
+//El DMA1 pasa Pixels[] al SPI1 a cada peticion SPI1TX y el CLC1 forma la
+//señal: con SDO=1 el nivel alto dura medio bit (T1H) y con SDO=0 lo que dura
+//el pulso PWM (T0H). La funcion vuelve sin esperar al envio; el final lo
+//marcan PixDMAFin() y PixDMALatch() desde las interrupciones
+	PixEnviando = TRUE;
+	DMASELECT = 0;
+	DMAnCON0 = 0;				//desactivado para recargar el contador de origen
+	DMAnSSA = Pixels;
+	DMAnSSZ = Bytes;
+	DMAnCON0 = 0xC0;			//EN + SIRQEN: el SPI vacio pide ya el primer byte
+#else
 	GIEVal = GIE;	//Guardo valor de global interrupt enable
 	GIE = 0;		//Deshabilito interrupciones
+	PIX_PROF_INICIO(PixTIrq);	//fuera de la zona critica, no afecta a los tiempos
 	
-	i = PIX_NUM_BYTES;	//Numero de bytes a enviar
+#ifdef __PCH__
+	//Numero de bytes a enviar en PRODH:PRODL. PRODL cuenta los bytes y PRODH
+	//las vueltas de 256, asi que si la parte baja no es 0 cuenta una vuelta mas
+	PRODL = make8(Bytes, 0);
+	PRODH = make8(Bytes + 255, 1);
+#else
+	i = Bytes;	//Numero de bytes a enviar
+#endif
 	
 #ifdef PIX_DELAY_TIMER2
 	//Espero a que hayan transcurrido 50uS antes de volver a enviar
+#ifdef PIX_DORMIR
+	//En IDLE: la CPU se para, el Timer2 sigue y su flag despierta al PIC. Con
+	//GIE=0 no se salta a ninguna interrupcion, se sigue despues del SLEEP.
+	//Si despierta otra interrupcion habilitada se vuelve a dormir. PEIE,
+	//TMR2IE e IDLEN quedan como los tenia el programa (un sleep() suyo
+	//tiene que seguir siendo SLEEP y no IDLE)
+	if(TMR2IF == FALSE){
+		short PEIEval = PEIE;
+		short TMR2IEval = TMR2IE;
+		short IDLENval = IDLEN;
+		PEIE = 1;
+		TMR2IE = 1;
+		IDLEN = 1;
+		while(TMR2IF == FALSE){sleep();}
+		IDLEN = IDLENval;
+		TMR2IE = TMR2IEval;
+		PEIE = PEIEval;
+	}
+#else
 	while(TMR2IF == FALSE){delay_cycles(1);}
+#endif
 #endif
 
 	//Apunto FSR0 al inicio de mis bytes
@@ -226,959 +772,327 @@ int i;				//Loop
 	//empezar con el envio de datos
 	output_low(PIX_PIN);
 
-#if getenv("CLOCK") == 48000000
-// ==================== ENVIO DE DATOS A 48MHZ ====================
-
+//Los bucles de envio usan el pin y la velocidad de la tira principal
+#define PIX_ENV_PIN		PIX_PIN
+#define PIX_ENV_PORT	PIX_ASM_PORT
+#define PIX_ENV_BIT		PIX_ASM_BIT
 #ifdef PIX_800KHZ
-//Envio de datos a 800Khz (48Mhz clock)
-//15 instrucciones por cada bit: HHHHHxxxxxLLLLL
-//OUT instructions:              ^    ^    ^      (T=0,5,10)
-//Para bit 0: T0H=5*83.33ns=416ns, T0L=10*83.33ns=833ns
-//Para bit 1: T1H=10*83.33ns=833ns, T1L=5*83.33ns=416ns
-
-
-// ===== VERSION EN C (COMENTADA) =====
-SendByte48_800:				//Clk	Instr   Tiempo
-	//bit7 ---
-	output_high(PIX_PIN);	//0		1       83.33ns
-	delay_cycles(2);		//1-3	3       250ns
-	if(!bit_test(INDF0, 7))	//4		1       83.33ns
-		output_low(PIX_PIN);//5		1       83.33ns
-	delay_cycles(5);		//6-9	4       333.33ns
-	output_low(PIX_PIN);	//10	1       83.33ns
-	delay_cycles(4);		//11-14	4       333.33ns
-	
-	//bit6 ---
-	output_high(PIX_PIN);	//0		1       83.33ns
-	delay_cycles(2);		//1-3	3       250ns
-	if(!bit_test(INDF0, 6))	//4		1       83.33ns
-		output_low(PIX_PIN);//5		1       83.33ns
-	delay_cycles(5);		//6-9	4       333.33ns
-	output_low(PIX_PIN);	//10	1       83.33ns
-	delay_cycles(4);		//11-14	4       333.33ns
-	
-	//bit5 ---
-	output_high(PIX_PIN);	//0		1       83.33ns
-	delay_cycles(2);		//1-3	3       250ns
-	if(!bit_test(INDF0, 5))	//4		1       83.33ns
-		output_low(PIX_PIN);//5		1       83.33ns
-	delay_cycles(5);		//6-9	4       333.33ns
-	output_low(PIX_PIN);	//10	1       83.33ns
-	delay_cycles(4);		//11-14	4       333.33ns
-	
-	//bit4 ---
-	output_high(PIX_PIN);	//0		1       83.33ns
-	delay_cycles(2);		//1-3	3       250ns
-	if(!bit_test(INDF0, 4))	//4		1       83.33ns
-		output_low(PIX_PIN);//5		1       83.33ns
-	delay_cycles(5);		//6-9	4       333.33ns
-	output_low(PIX_PIN);	//10	1       83.33ns
-	delay_cycles(4);		//11-14	4       333.33ns
-	
-	//bit3 ---
-	output_high(PIX_PIN);	//0		1       83.33ns
-	delay_cycles(2);		//1-3	3       250ns
-	if(!bit_test(INDF0, 3))	//4		1       83.33ns
-		output_low(PIX_PIN);//5		1       83.33ns
-	delay_cycles(5);		//6-9	4       333.33ns
-	output_low(PIX_PIN);	//10	1       83.33ns
-	delay_cycles(4);		//11-14	4       333.33ns
-	
-	//bit2 ---
-	output_high(PIX_PIN);	//0		1       83.33ns
-	delay_cycles(2);		//1-3	3       250ns
-	if(!bit_test(INDF0, 2))	//4		1       83.33ns
-		output_low(PIX_PIN);//5		1       83.33ns
-	delay_cycles(5);		//6-9	4       333.33ns
-	output_low(PIX_PIN);	//10	1       83.33ns
-	delay_cycles(4);		//11-14	4       333.33ns
-	
-	//bit1 ---
-	output_high(PIX_PIN);	//0		1       83.33ns
-	delay_cycles(2);		//1-3	3       250ns
-	if(!bit_test(INDF0, 1))	//4		1       83.33ns
-		output_low(PIX_PIN);//5		1       83.33ns
-	delay_cycles(5);		//6-9	4       333.33ns
-	output_low(PIX_PIN);	//10	1       83.33ns
-	delay_cycles(4);		//11-14	4       333.33ns
-	
-	//bit0 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(2);		//1-2	2
-	if(!bit_test(INDF0, 0))	//3		1
-		output_low(PIX_PIN);//4		1
-	
-#asm
-	DECFSZ	i, F			//5		1	decrementar contador de bytes enviados, si es cero salta 1 -> listo.
-	GOTO	Salto48_800		//6-7	2	salta 1 instruccion
-	GOTO	Listo48_800		//6-7	2	todo enviado. Salir
-#endasm
+#define PIX_ENV_800
+#endif
+#include "led_pixels_envio.c"
+#undef PIX_ENV_PIN
+#undef PIX_ENV_PORT
+#undef PIX_ENV_BIT
+#undef PIX_ENV_800
 
-Salto48_800:
-	FSR0L++;				//8		1	incrementar puntero
-	output_low(PIX_PIN);	//9		1
-	goto SendByte48_800;	//10-11	2	vuelve al principio
+#ifdef PIX_DELAY_TIMER2
+	//La demora de 50uS se genera con el Timer2
+	TMR2 = 0;			//Reinicio contador de Timer2
+	TMR2IF = FALSE;		//Quito flag de interrupcion
+#else
+	//La demora de 50uS se genera con un delay
+	delay_us(50);		//espero 50uS para volver a enviar
+#endif	//Fin de la estructura principal de seleccion de frecuencia
 
-Listo48_800:
-	output_low(PIX_PIN);	//8
-	delay_cycles(4);		//6		3
-	//Fin de transmisio
+	PIX_PROF_PARAR(PixTIrq);	//solo lee el Timer1: acumular alarga la zona critica
+	GIE = GIEval;		//restauro valor de GIE
+	PIX_PROF_SUMAR(PixTIrq, PIX_PROF_IRQOFF);
+#endif	//Fin de PIX_APA102
 
-// ===== VERSION EN ASM (ACTIVA) =====
-// 15 instrucciones por cada bit: HHHHHxxxxxLLLLL
-// Para bit 0: T0H=5*83.33ns=416ns, T0L=10*83.33ns=833ns
-// Para bit 1: T1H=10*83.33ns=833ns, T1L=5*83.33ns=416ns
-/*#asm asis
-SendByte48_800:
-	; ===== BIT 7 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1 (equivalente: output_high(PIX_PIN))
-	NOP						; [1] delay 1 ciclo
-	NOP						; [2] delay 1 ciclo
-	NOP						; [3] delay 1 ciclo (equivalente: delay_cycles(3))
-	BTFSC	INDF0, 7		; [4] test bit 7, skip if clear (equivalente: if(!bit_test(INDF0, 7)))
-	GOTO	Skip_B7			; [5] si bit=1, salta clear del pin
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [5] PIX = 0 si bit=0 (equivalente: output_low(PIX_PIN))
-Skip_B7:
-	NOP						; [6] delay 1 ciclo
-	NOP						; [7] delay 1 ciclo
-	NOP						; [8] delay 1 ciclo
-	NOP						; [9] delay 1 ciclo (equivalente: delay_cycles(4))
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [10] PIX = 0 (equivalente: output_low(PIX_PIN))
-	NOP						; [11] delay 1 ciclo
-	NOP						; [12] delay 1 ciclo
-	NOP						; [13] delay 1 ciclo
-	NOP						; [14] delay 1 ciclo (equivalente: delay_cycles(4))
-	
-	; ===== BIT 6 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	BTFSC	INDF0, 6		; [4] test bit 6
-	GOTO	Skip_B6			; [5] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [5] PIX = 0 si bit=0
-Skip_B6:
-	NOP						; [6] delay
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [10] PIX = 0
-	NOP						; [11] delay
-	NOP						; [12] delay
-	NOP						; [13] delay
-	NOP						; [14] delay
-	
-	; ===== BIT 5 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	BTFSC	INDF0, 5		; [4] test bit 5
-	GOTO	Skip_B5			; [5] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [5] PIX = 0 si bit=0
-Skip_B5:
-	NOP						; [6] delay
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [10] PIX = 0
-	NOP						; [11] delay
-	NOP						; [12] delay
-	NOP						; [13] delay
-	NOP						; [14] delay
-	
-	; ===== BIT 4 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	BTFSC	INDF0, 4		; [4] test bit 4
-	GOTO	Skip_B4			; [5] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [5] PIX = 0 si bit=0
-Skip_B4:
-	NOP						; [6] delay
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [10] PIX = 0
-	NOP						; [11] delay
-	NOP						; [12] delay
-	NOP						; [13] delay
-	NOP						; [14] delay
-	
-	; ===== BIT 3 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	BTFSC	INDF0, 3		; [4] test bit 3
-	GOTO	Skip_B3			; [5] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [5] PIX = 0 si bit=0
-Skip_B3:
-	NOP						; [6] delay
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [10] PIX = 0
-	NOP						; [11] delay
-	NOP						; [12] delay
-	NOP						; [13] delay
-	NOP						; [14] delay
-	
-	; ===== BIT 2 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	BTFSC	INDF0, 2		; [4] test bit 2
-	GOTO	Skip_B2			; [5] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [5] PIX = 0 si bit=0
-Skip_B2:
-	NOP						; [6] delay
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [10] PIX = 0
-	NOP						; [11] delay
-	NOP						; [12] delay
-	NOP						; [13] delay
-	NOP						; [14] delay
-	
-	; ===== BIT 1 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	BTFSC	INDF0, 1		; [4] test bit 1
-	GOTO	Skip_B1			; [5] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [5] PIX = 0 si bit=0
-Skip_B1:
-	NOP						; [6] delay
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [10] PIX = 0
-	NOP						; [11] delay
-	NOP						; [12] delay
-	NOP						; [13] delay
-	NOP						; [14] delay
-	
-	; ===== BIT 0 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	BTFSC	INDF0, 0		; [4] test bit 0
-	GOTO	Skip_B0			; [5] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [5] PIX = 0 si bit=0
-Skip_B0:
-	NOP						; [6] delay
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [10] PIX = 0
+#ifdef PIX_AHORRO
+	if(PixEncendidos == 0){
+		PixApagada = TRUE;	//trama negra enviada
+	#ifdef PIX_POWER_PIN
+		PIX_POWER_OFF();	//con PIX_DMA puede cortar en mitad del envio, da igual: es negro
+	#endif
+	}
+#endif
 	
-	; ===== CONTROL DE LOOP =====
-	DECFSZ	i, F			; [11] decrementar contador (equivalente: decrementar i)
-	GOTO	Salto48_800		; [12] si no es cero, continuar
-	GOTO	Listo48_800		; [13] si es cero, terminar
-
-Salto48_800:
-	INCF	FSR0L, F		; [14] incrementar puntero (equivalente: FSR0L++)
-	GOTO	SendByte48_800	; [0-1] volver al inicio
-
-Listo48_800:
-	NOP						; [14] delay
-	NOP						; [15] delay
-	NOP						; [16] delay (equivalente: delay_cycles(3))
-	; Fin de transmision
-#endasm*/
+	PIX_PROF_FIN(PixT, PIX_PROF_MOSTRAR);
+}
 
+#ifdef PIX_MAX_MA
+/*
+ * Recalcula PixSumaColor recorriendo todo el buffer, con el mismo peso por
+ * canal que PIX_SUMA_PIXEL()
+ */
+void PixSumarBuffer(void){
+int *ptr;
+PixIndice i;
+	
+	PixSumaColor = 0;
+	ptr = Pixels;
+	for(i = 0; i < PIX_NUM_LEDS; i++){
+#ifdef PIX_SUMA_PESOS
+		PixSumaColor += (int32)_mul(ptr[PIX_POS_R], PIX_MA_R) + _mul(ptr[PIX_POS_G], PIX_MA_G) + _mul(ptr[PIX_POS_B], PIX_MA_B);
 #else
-//Envio de datos a 400Khz (48Mhz clock)
-//30 instrucciones por cada bit: HHHHHHxxxxxxLLLLLLLLLLLLLLLL
-//OUT instructions:              ^     ^     ^               (T=0,6,12)
+		PixSumaColor += (long)ptr[0] + ptr[1] + ptr[2];
+#endif
+		ptr += 3;
+	}
+	PixSumaValida = TRUE;
+}
 
 /*
-// ===== VERSION EN C (COMENTADA) =====
-SendByte48_400:				//Clk	Instr   Tiempo
-	//bit7 ---
-	output_high(PIX_PIN);	//0		1       83.33ns
-	delay_cycles(4);		//1-4	4       333.33ns
-	if(!bit_test(INDF0, 7))	//5		1       83.33ns
-		output_low(PIX_PIN);//6		1       83.33ns
-	delay_cycles(5);		//7-11	5       416.67ns
-	output_low(PIX_PIN);	//12		1       83.33ns
-	delay_cycles(17);		//13-29	17      1.41us
-	
-	//bit6 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(4);		//1-4	4
-	if(!bit_test(INDF0, 6))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(5);		//7-11	5
-	output_low(PIX_PIN);	//12		1
-	delay_cycles(17);		//13-29	17
-	
-	//bit5 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(4);		//1-4	4
-	if(!bit_test(INDF0, 5))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(5);		//7-11	5
-	output_low(PIX_PIN);	//12		1
-	delay_cycles(17);		//13-29	17
-	
-	//bit4 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(4);		//1-4	4
-	if(!bit_test(INDF0, 4))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(5);		//7-11	5
-	output_low(PIX_PIN);	//12		1
-	delay_cycles(17);		//13-29	17
+ * Estima el consumo de la tira y, si supera PIX_MAX_MA, escala todo el buffer
+ * para dejarlo dentro del presupuesto. Lo llama MostrarPixels() antes de enviar.
+ * Devuelve TRUE si ha escalado el buffer, con la escala en PixLimiteEscala
+ * 
+ * La suma de color se mantiene en los setters, asi que normalmente esto es
+ * solo una comparacion. Solo se recorre el buffer si alguna funcion lo ha
+ * modificado en bloque (PIX_BUFFER_TOCADO) o si hay que recortar el consumo
+ */
+short PixLimitarConsumo(void){
+int Escala;
 	
-	//bit3 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(4);		//1-4	4
-	if(!bit_test(INDF0, 3))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(5);		//7-11	5
-	output_low(PIX_PIN);	//12		1
-	delay_cycles(17);		//13-29	17
+	if(PixSumaValida == FALSE) PixSumarBuffer();
 	
-	//bit2 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(4);		//1-4	4
-	if(!bit_test(INDF0, 2))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(5);		//7-11	5
-	output_low(PIX_PIN);	//12		1
-	delay_cycles(17);		//13-29	17
+	if(PixSumaColor <= PIX_SUMA_MAX) return FALSE;	//dentro del presupuesto
 	
-	//bit1 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(4);		//1-4	4
-	if(!bit_test(INDF0, 1))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(5);		//7-11	5
-	output_low(PIX_PIN);	//12		1
-	delay_cycles(17);		//13-29	17
+	//Escala de 8 bits redondeada hacia abajo: la suma escalada nunca supera el maximo
+	Escala = (PIX_SUMA_MAX << 8) / PixSumaColor;
+	PixLimiteEscala = Escala;		//para escalar igual copias del buffer (capas)
 	
-	//bit0 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(4);		//1-4	4
-	if(!bit_test(INDF0, 0))	//5		1
-		output_low(PIX_PIN);	//6		1
-	delay_cycles(5);		//7-11	5
-	output_low(PIX_PIN);	//12		1
+	PixEscalarBytes(Pixels, PIX_NUM_BYTES, Escala);
+	PIX_ENC_TOCADO();	//los canales pequeños pueden quedar a 0 y apagar el LED
 	
-#asm
-	DECFSZ	i, F			//13	1	decrementar contador de bytes enviados, si es cero salta 1 -> listo.
-	GOTO	Salto48_400		//14	2	salta 1 instruccion
-	GOTO	Listo48_400		//15	2	todo enviado. Salir
-#endasm
-Salto48_400:
-	FSR0L++;				//16	1	incrementar puntero
-	delay_cycles(12);		//17-28	12
-	goto SendByte48_400;	//29		2	vuelve al principio
-
-Listo48_400:	
-	delay_cycles(16);		//14-29	16
-*/
+	PixSumarBuffer();
+	return TRUE;
+}
+#endif
 
-// ===== VERSION EN ASM (ACTIVA) =====
-// 30 instrucciones por cada bit: HHHHHHxxxxxxLLLLLLLLLLLLLLLL
-// Para bit 0: T0H=6*83.33ns=500ns, T0L=24*83.33ns=2us
-// Para bit 1: T1H=18*83.33ns=1.5us, T1L=12*83.33ns=1us
-#asm asis
-SendByte48_400:
-	; ===== BIT 7 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	NOP						; [4] delay
-	BTFSC	INDF0, 7		; [5] test bit 7
-	GOTO	Skip_B7_400		; [6] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [6] PIX = 0 si bit=0
-Skip_B7_400:
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	NOP						; [10] delay
-	NOP						; [11] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [12] PIX = 0
-	NOP						; [13] delay
-	NOP						; [14] delay
-	NOP						; [15] delay
-	NOP						; [16] delay
-	NOP						; [17] delay
-	NOP						; [18] delay
-	NOP						; [19] delay
-	NOP						; [20] delay
-	NOP						; [21] delay
-	NOP						; [22] delay
-	NOP						; [23] delay
-	NOP						; [24] delay
-	NOP						; [25] delay
-	NOP						; [26] delay
-	NOP						; [27] delay
-	NOP						; [28] delay
-	NOP						; [29] delay
-	
-	; ===== BIT 6 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	NOP						; [4] delay
-	BTFSC	INDF0, 6		; [5] test bit 6
-	GOTO	Skip_B6_400		; [6] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [6] PIX = 0 si bit=0
-Skip_B6_400:
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	NOP						; [10] delay
-	NOP						; [11] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [12] PIX = 0
-	NOP						; [13] delay
-	NOP						; [14] delay
-	NOP						; [15] delay
-	NOP						; [16] delay
-	NOP						; [17] delay
-	NOP						; [18] delay
-	NOP						; [19] delay
-	NOP						; [20] delay
-	NOP						; [21] delay
-	NOP						; [22] delay
-	NOP						; [23] delay
-	NOP						; [24] delay
-	NOP						; [25] delay
-	NOP						; [26] delay
-	NOP						; [27] delay
-	NOP						; [28] delay
-	NOP						; [29] delay
-	
-	; ===== BIT 5 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	NOP						; [4] delay
-	BTFSC	INDF0, 5		; [5] test bit 5
-	GOTO	Skip_B5_400		; [6] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [6] PIX = 0 si bit=0
-Skip_B5_400:
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	NOP						; [10] delay
-	NOP						; [11] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [12] PIX = 0
-	NOP						; [13] delay
-	NOP						; [14] delay
-	NOP						; [15] delay
-	NOP						; [16] delay
-	NOP						; [17] delay
-	NOP						; [18] delay
-	NOP						; [19] delay
-	NOP						; [20] delay
-	NOP						; [21] delay
-	NOP						; [22] delay
-	NOP						; [23] delay
-	NOP						; [24] delay
-	NOP						; [25] delay
-	NOP						; [26] delay
-	NOP						; [27] delay
-	NOP						; [28] delay
-	NOP						; [29] delay
-	
-	; ===== BIT 4 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	NOP						; [4] delay
-	BTFSC	INDF0, 4		; [5] test bit 4
-	GOTO	Skip_B4_400		; [6] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [6] PIX = 0 si bit=0
-Skip_B4_400:
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	NOP						; [10] delay
-	NOP						; [11] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [12] PIX = 0
-	NOP						; [13] delay
-	NOP						; [14] delay
-	NOP						; [15] delay
-	NOP						; [16] delay
-	NOP						; [17] delay
-	NOP						; [18] delay
-	NOP						; [19] delay
-	NOP						; [20] delay
-	NOP						; [21] delay
-	NOP						; [22] delay
-	NOP						; [23] delay
-	NOP						; [24] delay
-	NOP						; [25] delay
-	NOP						; [26] delay
-	NOP						; [27] delay
-	NOP						; [28] delay
-	NOP						; [29] delay
-	
-	; ===== BIT 3 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	NOP						; [4] delay
-	BTFSC	INDF0, 3		; [5] test bit 3
-	GOTO	Skip_B3_400		; [6] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [6] PIX = 0 si bit=0
-Skip_B3_400:
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	NOP						; [10] delay
-	NOP						; [11] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [12] PIX = 0
-	NOP						; [13] delay
-	NOP						; [14] delay
-	NOP						; [15] delay
-	NOP						; [16] delay
-	NOP						; [17] delay
-	NOP						; [18] delay
-	NOP						; [19] delay
-	NOP						; [20] delay
-	NOP						; [21] delay
-	NOP						; [22] delay
-	NOP						; [23] delay
-	NOP						; [24] delay
-	NOP						; [25] delay
-	NOP						; [26] delay
-	NOP						; [27] delay
-	NOP						; [28] delay
-	NOP						; [29] delay
-	
-	; ===== BIT 2 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	NOP						; [4] delay
-	BTFSC	INDF0, 2		; [5] test bit 2
-	GOTO	Skip_B2_400		; [6] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [6] PIX = 0 si bit=0
-Skip_B2_400:
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	NOP						; [10] delay
-	NOP						; [11] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [12] PIX = 0
-	NOP						; [13] delay
-	NOP						; [14] delay
-	NOP						; [15] delay
-	NOP						; [16] delay
-	NOP						; [17] delay
-	NOP						; [18] delay
-	NOP						; [19] delay
-	NOP						; [20] delay
-	NOP						; [21] delay
-	NOP						; [22] delay
-	NOP						; [23] delay
-	NOP						; [24] delay
-	NOP						; [25] delay
-	NOP						; [26] delay
-	NOP						; [27] delay
-	NOP						; [28] delay
-	NOP						; [29] delay
-	
-	; ===== BIT 1 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	NOP						; [4] delay
-	BTFSC	INDF0, 1		; [5] test bit 1
-	GOTO	Skip_B1_400		; [6] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [6] PIX = 0 si bit=0
-Skip_B1_400:
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	NOP						; [10] delay
-	NOP						; [11] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [12] PIX = 0
-	NOP						; [13] delay
-	NOP						; [14] delay
-	NOP						; [15] delay
-	NOP						; [16] delay
-	NOP						; [17] delay
-	NOP						; [18] delay
-	NOP						; [19] delay
-	NOP						; [20] delay
-	NOP						; [21] delay
-	NOP						; [22] delay
-	NOP						; [23] delay
-	NOP						; [24] delay
-	NOP						; [25] delay
-	NOP						; [26] delay
-	NOP						; [27] delay
-	NOP						; [28] delay
-	NOP						; [29] delay
+#ifdef PIX_AHORRO
+/*
+ * Recuenta los LEDs con algun canal distinto de 0. Solo hace falta despues
+ * de modificar el buffer en bloque (PIX_BUFFER_TOCADO): los setters llevan la
+ * cuenta al vuelo
+ */
+void PixContarEncendidos(void){
+int *p = Pixels;
+PixIndice n;
 	
-	; ===== BIT 0 =====
-	BSF		PIX_ASM_PORT, PIX_ASM_BIT		; [0] PIX = 1
-	NOP						; [1] delay
-	NOP						; [2] delay
-	NOP						; [3] delay
-	NOP						; [4] delay
-	BTFSC	INDF0, 0		; [5] test bit 0
-	GOTO	Skip_B0_400		; [6] skip if bit=1
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [6] PIX = 0 si bit=0
-Skip_B0_400:
-	NOP						; [7] delay
-	NOP						; [8] delay
-	NOP						; [9] delay
-	NOP						; [10] delay
-	NOP						; [11] delay
-	BCF		PIX_ASM_PORT, PIX_ASM_BIT		; [12] PIX = 0
-	NOP						; [13] delay
-	NOP						; [14] delay
-	NOP						; [15] delay
-	NOP						; [16] delay
-	NOP						; [17] delay
-	NOP						; [18] delay
-	NOP						; [19] delay
-	NOP						; [20] delay
-	NOP						; [21] delay
-	NOP						; [22] delay
-	NOP						; [23] delay
-	NOP						; [24] delay
-	NOP						; [25] delay
-	NOP						; [26] delay
-	NOP						; [27] delay
-	NOP						; [28] delay
+	PixEncendidos = 0;
+	for(n = 0; n < PIX_NUM_LEDS; n++){
+		if(p[0] | p[1] | p[2]) PixEncendidos++;
+		p += 3;
+	}
+	PixEncendidosValido = TRUE;
+}
+#endif
+
+#ifdef PIX_LUT
+/*
+ * Rellena las tablas de los 3 canales: cada entrada es el valor (o PixCurva[]
+ * del valor) por el factor de balance del canal y por el brillo. Solo se
+ * llama al cambiar el brillo o el balance
+ */
+void PixLUTCalcular(void){
+int c, v, x;
+int *Tabla;
+long F;		//factor total en 8.8, de 0 a 256 (256 = sin cambio)
 	
-	; ===== CONTROL DE LOOP =====
-	DECFSZ	@i, F			; [29] decrementar contador
-	GOTO	Salto48_400		; [0-1] si no es cero, continuar
-	GOTO	Listo48_400		; [0-1] si es cero, terminar
+	for(c = 0; c < 3; c++){
+		if(c == 0) Tabla = PixLUTR;
+		else if(c == 1) Tabla = PixLUTG;
+		else Tabla = PixLUTB;
+		
+		//balance (255 = 1.0) por brillo (0 = 256 = 1.0)
+		F = (long)PixBalance[c] + 1;
+		if(Brillo != 0) F = (F * Brillo) >> 8;
+		
+		v = 0;
+		do{
+	#ifdef PIX_LUT_CURVA
+			x = PixCurva[v];
+	#else
+			x = v;
+	#endif
+			if(F >= 256)
+				Tabla[v] = x;
+			else
+				Tabla[v] = Escalar8(x, (int)F);
+		}while(++v != 0);
+	}
+}
 
-Salto48_400:
-	INCF	FSR0L, F		; [2] incrementar puntero
-	GOTO	SendByte48_400	; [3-4] volver al inicio
+/*
+ * Cambia los factores de balance de blancos (255 = sin cambio)
+ * No modifica lo que ya esta en el buffer, solo lo que se escriba despues
+ */
+void SetBalance(int r, int g, int b){
+	PixBalance[0] = r;
+	PixBalance[1] = g;
+	PixBalance[2] = b;
+	PixLUTCalcular();
+}
 
-Listo48_400:
-	NOP						; [2] delay
-	NOP						; [3] delay
-	NOP						; [4] delay
-	; Fin de transmision
-#endasm
+#ifdef PIX_LUT_EEPROM
+/*
+ * Guarda los factores actuales para que InitPixels() los lea al arrancar
+ */
+void GuardarBalance(void){
+	write_eeprom(PIX_LUT_EEPROM, PixBalance[0]);
+	write_eeprom(PIX_LUT_EEPROM + 1, PixBalance[1]);
+	write_eeprom(PIX_LUT_EEPROM + 2, PixBalance[2]);
+}
+#endif
+#endif
 
-#endif	//Fin de envio de datos a 48Mhz
+#ifdef PIX_DMA
+/*
+ * El DMA ha pasado el ultimo byte al SPI. Arranca el Timer 4, que cuenta lo
+ * que queda por salir del SPI mas los 50uS de reset
+ */
+#INT_DMA1SCNT
+void PixDMAFin(void){
+	T4TMR = 0;
+	T4CON = 0xC0;	//ON, divisor 16; en modo un disparo se para solo al llegar a T4PR
+}
 
-#elif getenv("CLOCK") == 24000000
-// ==================== ENVIO DE DATOS A 24MHZ (400KHZ) ====================
-//15 instrucciones por cada bit: HHHHxxxxxxLLLLLL
-//OUT instructions:              ^   ^     ^      (T=0,4,9)
-//1 ciclo = 166.667ns, por lo que:
-//T0H = 4 ciclos = 666.67ns (WS2811 spec: 500ns±150ns)
-//T1H = 9 ciclos = 1.5us (WS2811 spec: 1.2us±150ns)
-//T0L = 11 ciclos = 1.833us
-//T1L = 6 ciclos = 1us
-//Total = 2.5us por bit = 400KHz
+/*
+ * Fin del reset: ya se puede modificar Pixels[] y enviar otra trama
+ */
+#INT_TIMER4
+void PixDMALatch(void){
+	PixEnviando = FALSE;
+#ifdef PIX_DMA_FIN
+	PIX_DMA_FIN();
+#endif
+}
+#endif
 
-SendByte24_400:				//Clk	Instr
-	//bit7 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(2);		//1-2	2
-	if(!bit_test(INDF0, 7))	//3		1
-		output_low(PIX_PIN);//4		1
-	delay_cycles(4);		//5-8	4
-	output_low(PIX_PIN);	//9		1
-	delay_cycles(5);		//10-14	5
-	
-	//bit6 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(2);		//1-2	2
-	if(!bit_test(INDF0, 6))	//3		1
-		output_low(PIX_PIN);//4		1
-	delay_cycles(4);		//5-8	4
-	output_low(PIX_PIN);	//9		1
-	delay_cycles(5);		//10-14	5
-	
-	//bit5 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(2);		//1-2	2
-	if(!bit_test(INDF0, 5))	//3		1
-		output_low(PIX_PIN);//4		1
-	delay_cycles(4);		//5-8	4
-	output_low(PIX_PIN);	//9		1
-	delay_cycles(5);		//10-14	5
-	
-	//bit4 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(2);		//1-2	2
-	if(!bit_test(INDF0, 4))	//3		1
-		output_low(PIX_PIN);//4		1
-	delay_cycles(4);		//5-8	4
-	output_low(PIX_PIN);	//9		1
-	delay_cycles(5);		//10-14	5
-	
-	//bit3 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(2);		//1-2	2
-	if(!bit_test(INDF0, 3))	//3		1
-		output_low(PIX_PIN);//4		1
-	delay_cycles(4);		//5-8	4
-	output_low(PIX_PIN);	//9		1
-	delay_cycles(5);		//10-14	5
-	
-	//bit2 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(2);		//1-2	2
-	if(!bit_test(INDF0, 2))	//3		1
-		output_low(PIX_PIN);//4		1
-	delay_cycles(4);		//5-8	4
-	output_low(PIX_PIN);	//9		1
-	delay_cycles(5);		//10-14	5
-	
-	//bit1 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(2);		//1-2	2
-	if(!bit_test(INDF0, 1))	//3		1
-		output_low(PIX_PIN);//4		1
-	delay_cycles(4);		//5-8	4
-	output_low(PIX_PIN);	//9		1
-	delay_cycles(5);		//10-14	5
+#ifdef PIX_PROFILE
+/*
+ * Lee el Timer1 en ciclos, ampliado a 32 bits con los desbordes. TMR1IF se
+ * atiende aqui (no hay interrupcion), antes de leer y otra vez si salta
+ * durante la lectura, asi que entre dos lecturas cabe un desborde
+ * Se hace inline para no añadir una llamada a cada marca. Aun asi no es
+ * gratis: con el make32 y el desplazamiento son unas decenas de ciclos en
+ * PIC16, que PixPerfilReiniciar() mide y se descuentan de cada medida
+ */
+#inline
+int32 PixPerfilLeer(void){
+int h, l;
 	
-	//bit0 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(2);		//1-2	2
-	if(!bit_test(INDF0, 0))	//3		1
-		output_low(PIX_PIN);//4		1
-	delay_cycles(4);		//5-8	4
-	output_low(PIX_PIN);	//9		1
+	do{
+		if(TMR1IF){
+			TMR1IF = 0;
+			PixPerfilVueltas++;
+		}
+		h = TMR1H;
+		l = TMR1L;
+	}while((h != TMR1H) || TMR1IF);
 	
-#asm
-	DECFSZ	i, F			//10	1	decrementar contador de bytes enviados
-	GOTO	Salto24_400		//11	2	salta 1 instruccion
-	GOTO	Listo24_400		//12	2	todo enviado. Salir
-#endasm
-Salto24_400:
-	FSR0L++;				//13	1	incrementar puntero
-	delay_cycles(1);		//14	1
-	goto SendByte24_400;	//0		2	vuelve al principio
-
-Listo24_400:	
-	delay_cycles(4);		//13-14	2
-	//Fin de transmision
+	return make32(PixPerfilVueltas, h, l) << PIX_PROF_DESP;
+}
 
-#elif (defined(PIX_800KHZ) || (getenv("CLOCK") == 16000000))
-// ==================== ENVIO DE DATOS A 32MHZ/16MHZ ====================
-//Envio de datos a 800KHz (32MHz clock) o a 400KHz (16MHz clock)
-//La secuencia de instrucciones es la misma en ambos casos
-//10 instrucciones por cada bit: HHxxxxxLLL
-//OUT instructions:              ^ ^    ^   (T=0,2,7)
-//Para 32MHz (800KHz):
-//1 ciclo = 125ns, por lo que:
-//T0H = 3 ciclos = 375ns
-//T0L = 7 ciclos = 875ns
-//T1H = 7 ciclos = 875ns 
-//T1L = 3 ciclos = 375ns
-//Total = 1.25us por bit = 800KHz
+/*
+ * Empieza una medida: copia el coste acumulado de las medidas terminadas.
+ * El Timer1 se lee lo ultimo
+ */
+#inline
+void PixPerfilMarcar(PixMarca *m){
+	m->Gasto = PixPerfilGasto;
+	m->t = PixPerfilLeer();
+}
 
-//Para 16MHz (400KHz):
-//1 ciclo = 250ns, por lo que:
-//T0H = 2 ciclos = 500ns (WS2811 spec: 500ns±150ns)
-//T1H = 7 ciclos = 1.75us (WS2811 spec: 1.2us±150ns)
-//Total = 2.5us por bit = 400KHz
+/*
+ * Termina una medida: deja la duracion y lo que han costado las medidas
+ * anidadas (la diferencia del acumulado). El Timer1 se lee lo primero
+ */
+#inline
+void PixPerfilParar(PixMarca *m){
+	m->t = PixPerfilLeer() - m->t;
+	m->Gasto = PixPerfilGasto - m->Gasto;
+}
 
-SendByte1:					//Clk	Instr
-	//bit7 ---
-	output_high(PIX_PIN);	//0		1
-	if(!bit_test(INDF0, 7))	//1		1
-		output_low(PIX_PIN);//2		1
-	delay_cycles(4);		//3-6	4
-	output_low(PIX_PIN);	//7		1
-	delay_cycles(2);		//8-9	2
-	
-	//bit6 ---
-	output_high(PIX_PIN);	//0		1
-	if(!bit_test(INDF0, 6))	//1		1
-		output_low(PIX_PIN);//2		1
-	delay_cycles(4);		//3-6	4
-	output_low(PIX_PIN);	//7		1
-	delay_cycles(2);		//8-9	2
-	
-	//bit5 ---
-	output_high(PIX_PIN);	//0		1
-	if(!bit_test(INDF0, 5))	//1		1
-		output_low(PIX_PIN);//2		1
-	delay_cycles(4);		//3-6	4
-	output_low(PIX_PIN);	//7		1
-	delay_cycles(2);		//8-9	2
-	
-	//bit4 ---
-	output_high(PIX_PIN);	//0		1
-	if(!bit_test(INDF0, 4))	//1		1
-		output_low(PIX_PIN);//2		1
-	delay_cycles(4);		//3-6	4
-	output_low(PIX_PIN);	//7		1
-	delay_cycles(2);		//8-9	2
-	
-	//bit3 ---
-	output_high(PIX_PIN);	//0		1
-	if(!bit_test(INDF0, 3))	//1		1
-		output_low(PIX_PIN);//2		1
-	delay_cycles(4);		//3-6	4
-	output_low(PIX_PIN);	//7		1
-	delay_cycles(2);		//8-9	2
-	
-	//bit2 ---
-	output_high(PIX_PIN);	//0		1
-	if(!bit_test(INDF0, 2))	//1		1
-		output_low(PIX_PIN);//2		1
-	delay_cycles(4);		//3-6	4
-	output_low(PIX_PIN);	//7		1
-	delay_cycles(2);		//8-9	2
+/*
+ * Suma una medida ya parada al contador (id)
+ * Se le descuenta el coste de la propia medida y el de las anidadas. Cada
+ * medida terminada suma PixPerfilCoste al acumulado, asi que aqui no se
+ * multiplica nada: en PIC16 un _mul de 16x32 bits son cientos de ciclos
+ */
+void PixPerfilSumar(int id, PixMarca *m){
+	PixPerfil *p = &PixPerfiles[id];
+	int32 Ciclos, Gasto;
 	
-	//bit1 ---
-	output_high(PIX_PIN);	//0		1
-	if(!bit_test(INDF0, 1))	//1		1
-		output_low(PIX_PIN);//2		1
-	delay_cycles(4);		//3-6	4
-	output_low(PIX_PIN);	//7		1
-	delay_cycles(2);		//8-9	2
+	Gasto = PixPerfilSesgo + m->Gasto;
+	if(m->t > Gasto)
+		Ciclos = m->t - Gasto;
+	else
+		Ciclos = 0;
 	
-	//bit0 ---
-	output_high(PIX_PIN);	//0		1
-	if(!bit_test(INDF0, 0))	//1		1
-		output_low(PIX_PIN);//2		1
-#asm
-	DECFSZ	i, F			//3		1	decrementar contador de bytes enviados, si es cero salta 1 -> listo.
-	GOTO	Salto1			//4		2	salta 1 instruccion (no me deja usar GOTO $+2 ni BRA 2 ¿?)
-	GOTO	Listo1			//5		2	todo enviado. Salir
-#endasm
-Salto1:
-	FSR0L++;				//6		1	incremento puntero
-	output_low(PIX_PIN);	//7		1	PIN = LOW
-	goto SendByte1;			//8		2	vuelve al principio
+	if(Ciclos < p->Min) p->Min = Ciclos;
+	if(Ciclos > p->Max) p->Max = Ciclos;
+	p->Total += Ciclos;
+	p->Llamadas++;
+	PixPerfilGasto += PixPerfilCoste;
+}
 
-Listo1:	
-	output_low(PIX_PIN);	//7		1
-	delay_cycles(2);		//8		2
-	//Fin de transmision
-	
-#else
-//Envio de datos a 400Khz (32Mhz clock)
-//20 instrucciones por cada bit: HHHHHHxxxxxxLLLLLLLLLL
-//OUT instructions:              ^     ^     ^          (T=0,6,14)
-//270/1.25  900/1.25
-//540 -1800
+void PixPerfilAcumular(int id, PixMarca *m){
+	PixPerfilParar(m);
+	PixPerfilSumar(id, m);
+}
 
-#warning crear funcion en asm con bucle, ya que los tiempos son menos criticos
-SendByte2:					//Clk	Instr
-	//bit7 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(1);		//1-4	4
-	if(!bit_test(INDF0, 7))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(7);		//7-13	7
-	output_low(PIX_PIN);	//14	1
-	delay_cycles(5);		//15-19	5
-	
-	//bit6 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(1);		//1-4	4
-	if(!bit_test(INDF0, 6))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(7);		//7-13	7
-	output_low(PIX_PIN);	//14	1
-	delay_cycles(5);		//15-19	5
-	
-	//bit5 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(1);		//1-4	4
-	if(!bit_test(INDF0, 5))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(7);		//7-13	7
-	output_low(PIX_PIN);	//14	1
-	delay_cycles(5);		//15-19	5
-	
-	//bit4 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(1);		//1-4	4
-	if(!bit_test(INDF0, 4))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(7);		//7-13	7
-	output_low(PIX_PIN);	//14	1
-	delay_cycles(5);		//15-19	5
+/*
+ * Pone a cero todos los contadores y mide cuantos ciclos cuesta un par
+ * PIX_PROF_INICIO/PIX_PROF_FIN vacio (se descuenta de cada medida) y cuanto
+ * añade ese par a una medida de fuera (se descuenta por cada medida anidada)
+ */
+void PixPerfilReiniciar(void){
+int id;
+PixMarca Fuera, Dentro;
 	
-	//bit3 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(1);		//1-4	4
-	if(!bit_test(INDF0, 3))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(7);		//7-13	7
-	output_low(PIX_PIN);	//14	1
-	delay_cycles(5);		//15-19	5
+	PixPerfilSesgo = 0;
+	PixPerfilCoste = 0;
+	for(id = 0; id < 2; id++){
+		PixPerfiles[id].Total = 0;
+		PixPerfiles[id].Llamadas = 0;
+	}
 	
-	//bit2 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(1);		//1-4	4
-	if(!bit_test(INDF0, 2))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(7);		//7-13	7
-	output_low(PIX_PIN);	//14	1
-	delay_cycles(5);		//15-19	5
+	//par vacio: lo que mide es el sesgo
+	PixPerfilMarcar(&Dentro);
+	PixPerfilAcumular(0, &Dentro);
+	PixPerfilSesgo = PixPerfiles[0].Total;
 	
-	//bit1 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(1);		//1-4	4
-	if(!bit_test(INDF0, 1))	//5		1
-		output_low(PIX_PIN);//6		1
-	delay_cycles(7);		//7-13	7
-	output_low(PIX_PIN);	//14	1
-	delay_cycles(5);		//15-19	5
+	//par dentro de otro: lo que mide el de fuera, sin el sesgo, es el coste
+	PixPerfilMarcar(&Fuera);
+	PixPerfilMarcar(&Dentro);
+	PixPerfilAcumular(0, &Dentro);
+	PixPerfilAcumular(1, &Fuera);
+	PixPerfilCoste = PixPerfiles[1].Total;
 	
-	//bit0 ---
-	output_high(PIX_PIN);	//0		1
-	delay_cycles(1);		//1-4	4
-	if(!bit_test(INDF0, 7))	//5		1
-		output_low(PIX_PIN);//6		1
-
-#asm
-	DECFSZ	i, F			//7		1	decrementar contador de bytes enviados, si es cero salta 1 -> listo.
-	GOTO	Salto2			//8-9	2	salta 1 instruccion (no me deja usar GOTO $+2 ni BRA 2 ¿?)
-	GOTO	Listo2			//8-9	2	todo enviado. Salir
-#endasm
-Salto2:
-	FSR0L++;				//10	1	incremento puntero
-	delay_cycles(1);		//11-13	3
-	output_low(PIX_PIN);	//14	1
-	delay_cycles(2);		//15-17	3
-	goto SendByte2;			//18-19	2	vuelve al principio
-
-Listo2:	
-	delay_cycles(2);		//15-19	2
-	//Fin de transmision
-
-#endif	//Fin de envio de datos a 400Khz	//Fin de envio de datos a 24MHz
-
-#ifdef PIX_DELAY_TIMER2
-	//La demora de 50uS se genera con el Timer2
-	TMR2 = 0;			//Reinicio contador de Timer2
-	TMR2IF = FALSE;		//Quito flag de interrupcion
-#else
-	//La demora de 50uS se genera con un delay
-	delay_us(50);		//espero 50uS para volver a enviar
-#endif	//Fin de la estructura principal de seleccion de frecuencia
+	for(id = 0; id < PIX_PROF_NUM; id++){
+		PixPerfiles[id].Min = 0xFFFFFFFF;
+		PixPerfiles[id].Max = 0;
+		PixPerfiles[id].Total = 0;
+		PixPerfiles[id].Llamadas = 0;
+	}
+}
 
-	GIE = GIEval;		//restauro valor de GIE
+/*
+ * Imprime los contadores en formato CSV, una linea por funcion:
+ * funcion,llamadas,min,max,total (en ciclos de instruccion, Fosc/4)
+ */
+void PixPerfilImprimir(void){
+int id;
+	
+	for(id = 0; id < PIX_PROF_NUM; id++){
+		if(PixPerfiles[id].Llamadas == 0) continue;	//nunca llamada
+		
+		//los literales van directos a printf, CCS no admite punteros a ROM
+		switch(id){
+			case PIX_PROF_SET:		printf("SetPixel");	break;
+			case PIX_PROF_LLENAR:	printf("Llenar");	break;
+			case PIX_PROF_BRILLO:	printf("Brillo");	break;
+			case PIX_PROF_WHEEL:	printf("Wheel");	break;
+			case PIX_PROF_MOSTRAR:	printf("Mostrar");	break;
+			case PIX_PROF_IRQOFF:	printf("IrqOff");	break;
+			default:				printf("Extra%u", id - PIX_PROF_LIB);	break;
+		}
+		
+		printf(",%lu,%Lu,%Lu,%Lu\r\n", PixPerfiles[id].Llamadas,
+			PixPerfiles[id].Min, PixPerfiles[id].Max, PixPerfiles[id].Total);
+	}
 }
+#endif
@@ -68,6 +68,156 @@
  * se agrega una instruccion extra cada vez que se cambia el pin de estado
  * y esto descontrola los tiempos de envio -> es decir, NO FUNCIONA!
  * #use fast_io(a)
+ * 
+ * Para medir cuantos ciclos consume cada funcion de la libreria se puede
+ * activar el modo perfilado. Usa el Timer 1 como contador libre (Fosc/4, sin
+ * divisor), por lo que el programa no puede usarlo para otra cosa. Si no se
+ * define, las macros de perfilado desaparecen y no ocupan ni un byte:
+ * #define PIX_PROFILE
+ * #define PIX_PROFILE_DIV	8	//opcional: divisor del Timer1 (1, 2, 4 u 8)
+ * Los 16 bits del Timer1 se amplian a 32 con TMR1IF en cada lectura, asi que
+ * se ve un desborde entre dos lecturas seguidas: ningun tramo sin medidas
+ * (por ejemplo el envio con GIE = 0) puede durar 65536 cuentas o mas. No
+ * compila si el envio no cabe; con PIX_PROFILE_DIV cada cuenta son DIV
+ * ciclos y cabe un tramo DIV veces mas largo, a cambio de resolucion.
+ * Las medidas anidadas (SetPixelColor dentro de LlenarDeColor) no suman su
+ * propio coste de medida a la de fuera: PixPerfilReiniciar() lo mide y se
+ * descuenta una vez por cada medida de dentro (con un acumulado, sin
+ * multiplicar al cerrar cada medida).
+ * El programa puede medir lo suyo con PIX_PROF_INICIO/PIX_PROF_FIN en
+ * contadores propios, a partir de PIX_PROF_LIB:
+ * #define PIX_PROF_EXTRA	2	//opcional: contadores PIX_PROF_LIB + 0 y + 1
+ * 
+ * Limitador de consumo: si se define el presupuesto de corriente en mA, antes
+ * de cada envio se estima el consumo de la tira y, solo si se supera, se baja
+ * el brillo de todo el buffer lo justo para quedar dentro del limite. La
+ * estimacion se mantiene al vuelo en los setters, asi que comprobarla en
+ * MostrarPixels() no recorre el buffer. Igual que CambiarBrillo(), el ajuste
+ * modifica los valores guardados en RAM.
+ * #define PIX_MAX_MA		2000	//presupuesto de la fuente en mA
+ * #define PIX_MA_CANAL		20		//mA de cada canal R/G/B a 255 (por defecto 20)
+ * #define PIX_MA_REPOSO	1		//mA de cada LED apagado (por defecto 1)
+ * #define PIX_MA_R		20		//opcional: mA de cada canal por separado
+ * #define PIX_MA_G		12		//(por defecto PIX_MA_CANAL). Si son distintos
+ * #define PIX_MA_B		12		//la suma pesa cada canal, algo mas lenta
+ * 
+ * Balance de blancos: cada canal se multiplica por un factor (255 = sin
+ * cambio) para igualar el blanco de distintos lotes de LEDs. Los factores,
+ * el brillo y opcionalmente una curva de correccion (PixCurva[], gamma) se
+ * juntan en 3 tablas de 256 bytes en RAM (768 bytes), asi que los setters
+ * aplican todo con una consulta a tabla por canal, sin multiplicar. Las
+ * tablas se recalculan solo al cambiar el brillo o el balance. Los factores
+ * se pueden fijar al compilar, cambiar con SetBalance() o leer de la EEPROM
+ * en InitPixels(). tools/pix_balance.c calcula los factores (y la curva) a
+ * partir de la cromaticidad medida de cada canal.
+ * #define PIX_LUT
+ * #define PIX_BALANCE_R	255		//factores por defecto (0-255)
+ * #define PIX_BALANCE_G	230
+ * #define PIX_BALANCE_B	190
+ * #define PIX_LUT_EEPROM	0		//opcional: direccion de los 3 factores en EEPROM
+ * #define PIX_LUT_CURVA			//opcional: usar la tabla const int PixCurva[256]
+ * 
+ * Presupuesto de tiempo: con los ciclos por bit del bucle de envio de la
+ * configuracion elegida (reloj, 400/800KHz, PIC16/PIC18) se calculan al
+ * compilar PIX_FRAME_US (envio + reset de 50uS), PIX_MAX_FPS y
+ * PIX_IRQ_OFF_US (tiempo maximo con las interrupciones desactivadas en
+ * MostrarPixels()). No incluyen las pocas instrucciones de preparacion ni
+ * PixLimitarConsumo(). Si se define el refresco que necesita el programa o
+ * la latencia de interrupcion que admite, no compila si no se puede cumplir:
+ * #define PIX_TARGET_FPS	100		//fotogramas por segundo
+ * #define PIX_MAX_IRQ_US	500		//uS maximos sin atender interrupciones
+ * 
+ * Bajo consumo (PIX_AHORRO): los setters llevan la cuenta de LEDs encendidos
+ * (algun canal distinto de 0) igual que la suma de PIX_MAX_MA, y solo se
+ * recuenta el buffer si se ha modificado en bloque. Cuando toda la tira esta
+ * en negro MostrarPixels() envia una trama negra y a partir de ahi vuelve
+ * sin enviar ni desactivar interrupciones hasta que haya algo encendido
+ * (PixApagada = TRUE mientras tanto, el programa puede dormir mas tiempo).
+ * Con PIX_POWER_PIN ademas se corta la alimentacion de la tira con un MOSFET
+ * despues de la trama negra, y se vuelve a dar PIX_POWER_US antes de la
+ * siguiente trama con algo encendido. Con FAST_IO el pin tiene que estar
+ * configurado como salida. El pin de datos se queda en LOW para no alimentar
+ * el primer LED a traves de el.
+ * #define PIX_AHORRO
+ * #define PIX_POWER_PIN	PIN_C0	//opcional, implica PIX_AHORRO
+ * #define PIX_POWER_BAJO			//opcional: se enciende con LOW (MOSFET P)
+ * #define PIX_POWER_US		1000	//espera al encender la tira (por defecto 1000)
+ * 
+ * Con PIX_DORMIR la espera del reset de 50uS se hace con la CPU parada en
+ * modo IDLE (SLEEP con IDLEN = 1) en lugar de en un bucle: el Timer2 sigue
+ * contando y su flag despierta al PIC. Implica PIX_DELAY_TIMER2 y solo sirve
+ * en PICs con IDLEN (PIC18 y PIC16F1 con registro CPUDOZE); en el resto
+ * SLEEP para el Timer2 y no despertaria. No es para PIX_APA102 ni PIX_DMA.
+ * #define PIX_DORMIR
+ * 
+ * Hueco para el programa en el bucle de 48MHz / 400KHz (PIC16): en los 17
+ * ciclos que el bit 7 de cada byte pasa en bajo se puede ejecutar codigo
+ * propio en ensamblador, por ejemplo leer la UART o muestrear un pin mientras
+ * las interrupciones estan desactivadas. PIX_HUECO es un archivo con las
+ * instrucciones (se incluye dentro del bucle, sin CALL) y PIX_HUECO_CICLOS lo
+ * que tardan, que tiene que ser siempre lo mismo por cualquier camino. Si no
+ * cabe no compila, ni tampoco si la tira principal no va a 400KHz
+ * (PIX_400KHZ); lo que sobra se rellena con NOP. Las condiciones y un
+ * ejemplo con la UART estan en led_pixels_envio.c. Ejemplo, muestrear RB5 en
+ * la RAM comun cada byte enviado (3 ciclos: LSLF 1 + BTFSC/INCF 2):
+ * #define PIX_HUECO			"hueco.asm"
+ * #define PIX_HUECO_CICLOS	3
+ * hueco.asm:
+ * 	LSLF	0x70, F
+ * 	BTFSC	0x0D, 5
+ * 	INCF	0x70, F
+ * 
+ * Envio parcial: los WS281x mantienen lo ultimo que recibieron, asi que si
+ * solo cambian los primeros LEDs (barras de estado, indicadores de progreso)
+ * basta con enviar hasta el ultimo que ha cambiado y el resto de la tira se
+ * queda como estaba. La trama es mas corta y las interrupciones estan menos
+ * tiempo desactivadas; el reset de 50uS se sigue esperando igual.
+ * MostrarPixelsHasta(n) envia los n primeros LEDs. Con PIX_PREFIJO los
+ * setters guardan el LED mas alto escrito desde el ultimo envio (PixTope) y
+ * MostrarPixels() envia solo hasta ahi, o nada si no se ha escrito ninguno.
+ * Cualquier escritura cuenta aunque no cambie el color. Lo que modifica el
+ * buffer en bloque (PIX_BUFFER_TOCADO), el limitador de PIX_MAX_MA y el
+ * encendido con PIX_POWER_PIN obligan a enviar la tira entera. Si el programa
+ * escribe en Pixels[] directamente tiene que llamar a PIX_BUFFER_TOCADO().
+ * Con PIX_APA102 siempre se envia la tira entera.
+ * #define PIX_PREFIJO
+ * 
+ * Tiras APA102 / SK9822 (dos hilos, dato + reloj): en lugar del pin de datos
+ * se usa el MSSP en modo SPI (pines SDO/SCK del PIC). No tienen tiempos
+ * criticos, asi que funcionan a cualquier frecuencia de reloj, no hace falta
+ * FAST_IO ni PIX_PIN, y MostrarPixels() no desactiva las interrupciones.
+ * El brillo se envia en la cabecera de 5 bits de cada LED, por lo que
+ * CambiarBrillo() no modifica el buffer y no pierde resolucion de color.
+ * #define PIX_APA102
+ * #define PIX_SPI_DIV		SPI_CLK_DIV_4	//reloj SPI (por defecto Fosc/4)
+ * 
+ * Envio por DMA en PIC18 Q43/Q84 (PIX_DMA): el DMA1 copia Pixels[] al SPI1 y
+ * el CLC1 forma la señal WS2812 con SCK, SDO y el PWM del CCP1 (TMR2), asi
+ * que MostrarPixels() arranca la transferencia y vuelve enseguida, sin
+ * desactivar las interrupciones. Al acabar el DMA se arranca el Timer 4 que
+ * cuenta lo que falta por salir del SPI mas los 50uS de reset, y al
+ * desbordar pone PixEnviando a FALSE y llama a PIX_DMA_FIN() si esta
+ * definida. No hay que tocar Pixels[] mientras PixEnviando sea TRUE; si se
+ * llama a MostrarPixels() antes, espera a que termine el envio anterior.
+ * Usa DMA1, SPI1, CLC1, CCP1, TMR2 y TMR4, y PIX_PIN sale por CLC1OUT (PPS).
+ * Hay que habilitar las interrupciones globales en el programa.
+ * #define PIX_DMA
+ * #define PIX_DMA_FIN()	FinDeTrama()	//opcional, se llama desde la interrupcion
+ * 
+ * A 20MHz, 40MHz, 48MHz y 64MHz los bucles de envio estan en ensamblador y
+ * hay que indicar tambien la direccion del puerto y el bit del pin de datos:
+ * #define PIX_ASM_PORT	0x0C	//PORTA
+ * #define PIX_ASM_BIT		0
+ * Los bucles de 20, 40 y 64MHz (led_pixels_gen.c) se generan con la
+ * herramienta tools/pix_genbucle.c, que tambien sirve para otras frecuencias
+ * u otros chips (WS2813, WS2815, SK6812, TM1814...)
+ * 
+ * En PIC18 (compilador PCH) todas las frecuencias usan los bucles de
+ * led_pixels_gen18.c y PIX_ASM_PORT tiene que ser el registro LAT del pin:
+ * #define PIX_ASM_PORT	0xF8A	//LATB en PIC18F25K22
+ * #define PIX_ASM_BIT		0
+ * Alli el limite de 85 LEDs desaparece: el contador de bytes es de 16 bits y
+ * el buffer puede ocupar varios bancos, solo limita la RAM del PIC.
  * ---------------------------------------------------------------------------*/
 
 /* --------------------------------- FUNCIONES --------------------------------
@@ -94,14 +244,147 @@
  * -LlenarDeColor(int from, int to, int32 c)
  * Llena de un color (c) los pixels comprendidos entre (from) y (to)
  * 
+ * -AtenuarPixels(int Escala)
+ * Multiplica todo el buffer por Escala/256. A diferencia de CambiarBrillo()
+ * no cambia el brillo de lo que se escriba despues
+ * 
+ * -FundirANegro(int Cantidad)
+ * Baja todo el buffer Cantidad/256 hacia negro (estelas, desvanecidos)
+ * 
+ * -Escalar8(int v, int s) / Mezclar8(int a, int b, int t)
+ * -Sumar8(int a, int b) / Restar8(int a, int b)
+ * v*s/256, mezcla lineal de a hacia b, y suma/resta saturadas a 255/0. En
+ * PIC16 la multiplicacion va desenrollada en ensamblador (36 ciclos fijos)
+ * 
  * -MostrarPixels()
  * Envia la trama de datos a los LEDs. Cualquier otra operacion realizada
  * solo modifica los datos de color >> en la RAM <<, pero hasta que no se utiliza
  * MostrarPixels() no se enviara a los LEDs.
  * CUIDADO se desactivan las interrupciones mientras se envian datos!
+ * 
+ * -MostrarPixelsHasta(PixIndice n)
+ * Como MostrarPixels() pero solo envia los n primeros LEDs; los siguientes
+ * mantienen el color que ya tenian. Con n = 0 no envia nada. Con PIX_APA102
+ * envia siempre la tira entera
+ * 
+ * -PixContarEncendidos()				(solo con PIX_AHORRO)
+ * Recuenta los LEDs encendidos del buffer. La llama MostrarPixels() cuando
+ * el buffer se ha modificado en bloque
+ * 
+ * -SetBalance(int r, int g, int b)	(solo con PIX_LUT)
+ * Cambia los factores de balance de blancos y recalcula las tablas. Afecta a
+ * lo que se escriba despues, no al contenido actual del buffer
+ * 
+ * -GuardarBalance()					(solo con PIX_LUT_EEPROM)
+ * Guarda los factores actuales en la EEPROM
+ * 
+ * -PixPerfilReiniciar()				(solo con PIX_PROFILE)
+ * Pone a cero los contadores de perfilado y mide el coste de la propia medida
+ * 
+ * -PixPerfilImprimir()				(solo con PIX_PROFILE)
+ * Imprime con printf() los contadores min/max/total/llamadas de cada funcion.
+ * Requiere haber declarado un #use rs232 en el programa principal
  * ---------------------------------------------------------------------------*/
 
 /* --------------------------------- VERSIONES --------------------------------
+ * 
+ * v0.4.24 (19/Octubre/2026)
+ * -Modulo de guiones de luces (led_pixels_guion.c) y su ensamblador y
+ * simulador (tools/pix_guion.c)
+ * 
+ * v0.4.23 (19/Octubre/2026)
+ * -Envio parcial hasta el ultimo LED cambiado: MostrarPixelsHasta() y
+ * PIX_PREFIJO
+ * 
+ * v0.4.22 (19/Octubre/2026)
+ * -Hueco de ciclos fijos para codigo del programa en el bucle de 48MHz /
+ * 400KHz (PIX_HUECO, PIX_HUECO_CICLOS)
+ * 
+ * v0.4.21 (19/Octubre/2026)
+ * -Herramienta tools/pix_captura.c que decodifica capturas del pin de datos
+ * y mide los tiempos de cada bucle de envio
+ * 
+ * v0.4.20 (19/Octubre/2026)
+ * -Sprites en ROM con paleta, color transparente y recorte para matrices
+ * (led_pixels_sprite.c). bench.c mide Blit
+ * 
+ * v0.4.19 (19/Octubre/2026)
+ * -Modulo de capa superpuesta con transparencia (led_pixels_capas.c)
+ * -PixPrepararColor() pasa de la matriz a la libreria principal
+ * 
+ * v0.4.18 (19/Octubre/2026)
+ * -Bajo consumo: deteccion de tira en negro con cuenta incremental de LEDs
+ * encendidos (PIX_AHORRO), corte de alimentacion (PIX_POWER_PIN) y reset de
+ * 50uS en modo IDLE (PIX_DORMIR)
+ * 
+ * v0.4.17 (19/Octubre/2026)
+ * -Modulo de audio: muestreo del ADC por Timer 0, bandas con Goertzel y
+ * efectos de vumetro, bandas y pulso (led_pixels_audio.c)
+ * -Herramienta tools/pix_audio.c para probar el analisis con archivos WAV
+ * 
+ * v0.4.16 (19/Octubre/2026)
+ * -Modulo de ruido de 8 bits 1D/2D con evaluacion incremental por la tira
+ * (led_pixels_ruido.c)
+ * 
+ * v0.4.15 (19/Octubre/2026)
+ * -Modulo esclavo I2C con Pixels[] como mapa de registros (led_pixels_i2c.c)
+ * 
+ * v0.4.14 (19/Octubre/2026)
+ * -Operaciones de 8 bits Escalar8, Sumar8, Restar8, Mezclar8 y escalado del
+ * buffer por FSR (AtenuarPixels, FundirANegro). El brillo las usa
+ * 
+ * v0.4.13 (19/Octubre/2026)
+ * -Presupuesto de tiempo al compilar: PIX_FRAME_US, PIX_MAX_FPS,
+ * PIX_IRQ_OFF_US, y errores con PIX_TARGET_FPS y PIX_MAX_IRQ_US
+ * 
+ * v0.4.12 (19/Octubre/2026)
+ * -Balance de blancos y brillo en tablas de 256 bytes por canal (PIX_LUT)
+ * -Herramienta tools/pix_balance.c para calcular los factores
+ * 
+ * v0.4.11 (19/Octubre/2026)
+ * -Modulo de texto con fuente 5x7 / 3x5 en ROM y scroll incremental
+ * (led_pixels_texto.c)
+ * 
+ * v0.4.10 (19/Octubre/2026)
+ * -Modulo de matrices con coordenadas XY, giro, serpentina o tabla en ROM
+ * (led_pixels_matriz.c)
+ * 
+ * v0.4.9 (19/Octubre/2026)
+ * -Bucles de envio separados en led_pixels_envio.c (PIX_ENV_PIN/PORT/BIT/800)
+ * -Modulo de varias tiras independientes (led_pixels_tiras.c)
+ * 
+ * v0.4.8 (19/Octubre/2026)
+ * -Envio por DMA + CLC en PIC18 Q43/Q84 (PIX_DMA), sin bloquear la CPU
+ * 
+ * v0.4.7 (19/Octubre/2026)
+ * -Soporte para PIC18: bucles generados con POSTINC0 (led_pixels_gen18.c),
+ * contador de 16 bits y mas de 85 LEDs
+ * -Escalado de brillo en los setters con _mul() (MULWF en PIC18)
+ * 
+ * v0.4.6 (19/Octubre/2026)
+ * -Herramienta tools/pix_genbucle.c que genera los bucles de envio a partir
+ * de la frecuencia y los tiempos del chip
+ * -Soporte para 20MHz, 40MHz y 64MHz con bucles generados (led_pixels_gen.c)
+ * 
+ * v0.4.5 (19/Octubre/2026)
+ * -Soporte para tiras APA102/SK9822 por SPI (PIX_APA102)
+ * 
+ * v0.4.4 (19/Octubre/2026)
+ * -Modulo de fundido entre fotogramas (led_pixels_fundido.c)
+ * 
+ * v0.4.3 (19/Octubre/2026)
+ * -Limitador de consumo PIX_MAX_MA con suma de color incremental
+ * 
+ * v0.4.2 (19/Octubre/2026)
+ * -CambiarBrillo sin divisiones: tabla de inversos y escala 8.16, error
+ * menor de 1 bit por llamada y saturacion a 255 en lugar de desbordar
+ * 
+ * v0.4.1 (19/Octubre/2026)
+ * -Se añade bench.c, benchmark de las funciones de color con salida CSV
+ * 
+ * v0.4.0 (19/Octubre/2026)
+ * -Modo perfilado PIX_PROFILE: ciclos min/max/total por funcion y tiempo
+ * con interrupciones desactivadas en MostrarPixels()
  * 
  * v0.3.2 (24/Mayo/2017)
  * -Se incluye la funcion Wheel
@@ -138,13 +421,95 @@
    #warning "Compilador antiguo, comprueba que el codigo generado es valido"
 #endif
 
+#ifdef PIX_APA102
+	//APA102/SK9822: orden B, G, R y envio por SPI, sin tiempos criticos
+	#include "led_pixels_apa102.h"
+	#ifdef PIX_RGB
+		//el envio manda los bytes del buffer tal cual: tienen que estar en B, G, R
+		#error "PIX_RGB no vale con PIX_APA102: los APA102/SK9822 van en orden B, G, R"
+	#endif
+	#define PIX_BGR
+	#ifndef PIX_SPI_DIV
+		#define PIX_SPI_DIV		SPI_CLK_DIV_4
+	#endif
+	//Trama de fin: 32 bits para el SK9822 + 1 bit por cada 2 LEDs, redondeado a bytes
+	#define PIX_APA102_FIN		PIX_APA102_FIN_N(PIX_NUM_LEDS)
+	#if PIX_APA102_FIN > 255
+		#error "Demasiados LEDs para PIX_APA102: la trama de fin se cuenta con un int"
+	#endif
+#elif defined(PIX_DMA)
+	//WS2812 por DMA + SPI + CLC: los tiempos los da el hardware, no el codigo
+	#if !defined(__PCH__) || !getenv("SFR_VALID:DMASELECT") || !getenv("SFR_VALID:CLCSELECT")
+		#error "PIX_DMA necesita un PIC18 con DMA y CLC (Q43, Q84...)"
+	#endif
+	#ifndef PIX_PIN
+		#error "ERROR: PIX_PIN no definido"
+	#endif
+	#ifdef PIX_DELAY_TIMER2
+		#error "PIX_DMA usa el Timer 2 para el reloj del bit y el Timer 4 para el reset: quitar PIX_DELAY_TIMER2"
+	#endif
+	//Cada bit dura 2 periodos de TMR2 (SCK a la mitad): T1H = medio bit y
+	//T0H = ancho del pulso PWM. 750ns + 750ns = 667KHz, dentro de la
+	//tolerancia del WS2812 y con T1H centrado
+	#ifndef PIX_DMA_T1H_NS
+		#define PIX_DMA_T1H_NS		750
+	#endif
+	#ifndef PIX_DMA_T0H_NS
+		#define PIX_DMA_T0H_NS		375
+	#endif
+	#define PIX_DMA_PR2			((getenv("CLOCK") / 4000) * PIX_DMA_T1H_NS / 1000000 - 1)
+	#define PIX_DMA_PWM			((getenv("CLOCK") / 1000) * PIX_DMA_T0H_NS / 1000000)	//en Tosc
+	//Al acabar el DMA aun quedan 2 bytes en el SPI (TXB + desplazamiento)
+	#define PIX_DMA_ESPERA_US	(50 + (16 * 2 * PIX_DMA_T1H_NS) / 1000)
+	//Timer 4 a Fosc/4 con divisor 16
+	#define PIX_DMA_PR4			((getenv("CLOCK") / 64000) * PIX_DMA_ESPERA_US / 1000 - 1)
+	#if (PIX_DMA_PR2 < 1) || (PIX_DMA_PR2 > 255) || (PIX_DMA_PR4 > 255)
+		#error "PIX_DMA: frecuencia de reloj fuera de rango para los tiempos pedidos"
+	#endif
+	
+	//Seleccion de entradas del CLC y disparo del DMA. Valores de las tablas
+	//CLCnSELy, SPI1CLK y DMAnSIRQ del PIC18F-Q43; revisar en otros modelos
+	#ifndef PIX_CLC_SEL_SCK
+		#define PIX_CLC_SEL_SCK		0x2C	//SPI1 SCK
+	#endif
+	#ifndef PIX_CLC_SEL_SDO
+		#define PIX_CLC_SEL_SDO		0x2B	//SPI1 SDO
+	#endif
+	#ifndef PIX_CLC_SEL_PWM
+		#define PIX_CLC_SEL_PWM		0x1A	//CCP1
+	#endif
+	#ifndef PIX_SPI_CLK_TMR2
+		#define PIX_SPI_CLK_TMR2	0x07	//TMR2_Postscaled
+	#endif
+	#ifndef PIX_DMA_SIRQ_SPITX
+		#define PIX_DMA_SIRQ_SPITX	0x19	//SPI1TX
+	#endif
+	
+	#pin_select CLC1OUT=PIX_PIN
+#else
+
 //si no se ha definido PIX_400KHZ funciona a 800KHZ por defecto
 #ifndef PIX_400KHZ
 #define PIX_800KHZ
 #endif
 
 
-#if (getenv("CLOCK") == 48000000) || (getenv("CLOCK") == 32000000) || (getenv("CLOCK") == 24000000) || (getenv("CLOCK") == 16000000)
+//Frecuencias con bucle de envio generado por tools/pix_genbucle.c (led_pixels_gen.c)
+#if (getenv("CLOCK") == 20000000) || (getenv("CLOCK") == 40000000) || (getenv("CLOCK") == 64000000)
+	#define PIX_RELOJ_GENERADO
+#endif
+
+#ifdef __PCH__
+	//PIC18: todas las frecuencias usan los bucles de led_pixels_gen18.c
+	#if (getenv("CLOCK") != 16000000) && (getenv("CLOCK") != 20000000) && (getenv("CLOCK") != 24000000) && (getenv("CLOCK") != 32000000) && (getenv("CLOCK") != 40000000) && (getenv("CLOCK") != 48000000) && (getenv("CLOCK") != 64000000)
+		#error "PIC18: velocidades soportadas 16, 20, 24, 32, 40, 48 y 64MHz. Genera el bucle con tools/pix_genbucle.c -18"
+	#endif
+	#if defined(PIX_800KHZ) && ((getenv("CLOCK") == 24000000) || (getenv("CLOCK") == 16000000))
+		#error "A 16MHz y 24MHz solo puede enviar datos a 400KHz (WS2811). Para WS2812/WS2812B usar 32MHz o mas (800KHz)"
+	#endif
+#elif defined(PIX_RELOJ_GENERADO)
+	//PIC corriendo a 20, 40 o 64MHz: 400KHz y 800KHz (a 20MHz el modo 800KHz va a 625KHz)
+#elif (getenv("CLOCK") == 48000000) || (getenv("CLOCK") == 32000000) || (getenv("CLOCK") == 24000000) || (getenv("CLOCK") == 16000000)
 	//PIC corriendo a 16, 24, 32 o 48MHz
 	//Soporta 400KHz en todas (WS2811). 800KHz solo en 32/48MHz (WS2812/WS2812B)
 	#if defined(PIX_800KHZ) && ((getenv("CLOCK") == 24000000) || (getenv("CLOCK") == 16000000))
@@ -154,10 +519,11 @@
 		#warning "Modo 400KHz: probado con WS2811. WS2812/WS2812B pueden no funcionar correctamente a 400KHz; se recomienda 800KHz y usar 32MHz o 48MHz para WS2812/WS2812B."
 	#endif
 #else
-	#warning "Velocidad no probada. Velocidades soportadas: 16MHz, 24MHz, 32MHz, 48MHz"
+	#warning "Velocidad no probada. Velocidades soportadas: 16MHz, 20MHz, 24MHz, 32MHz, 40MHz, 48MHz, 64MHz. Genera el bucle con tools/pix_genbucle.c"
 #endif
 
-#if (getenv("CLOCK") == 48000000) && defined(PIX_800KHZ)
+#if (getenv("CLOCK") == 48000000) || defined(PIX_RELOJ_GENERADO) || defined(__PCH__)
+	//Los bucles en ensamblador acceden al pin por direccion de puerto y numero de bit
 	#ifndef PIX_ASM_PORT
 		#error "ERROR: PIX_ASM_PORT no definido. Define: #define PIX_ASM_PORT 0x0E (reemplaza con la dirección correcta del puerto)"
 	#endif
@@ -171,29 +537,268 @@
 	#endif
 #endif
 
+#endif	//Fin de PIX_APA102 / PIX_DMA
+
 #ifndef PIX_NUM_LEDS
 	#error "PIX_NUM_LEDS no definido"
 #else
-	#if PIX_NUM_LEDS > 85
+	#if (PIX_NUM_LEDS > 85) && !defined(__PCH__) && !defined(PIX_APA102)
 		//Solo podemos usar un maximo de 85 leds.
 		//Cada led usa 3 bytes, y nuestro contador de envio es un INT
+		//(en PIC18 y con APA102 el contador es de 16 bits)
 		#error "PIX_NUM_LEDS tiene que ser menor a 85"
 	#elif (PIX_NUM_LEDS*3) > getenv("RAM")
 		#error "Tu PIC no tiene suficiente RAM para tantos LEDs"
 	#endif
 #endif
 
+#ifdef PIX_MAX_MA
+	#ifndef PIX_MA_CANAL
+		#define PIX_MA_CANAL	20	//WS2812: ~20mA por canal a maximo brillo
+	#endif
+	#ifndef PIX_MA_REPOSO
+		#define PIX_MA_REPOSO	1	//WS2812: ~1mA por LED aunque este apagado
+	#endif
+	//cada canal puede tener su consumo (el azul y el verde suelen gastar menos)
+	#ifndef PIX_MA_R
+		#define PIX_MA_R		PIX_MA_CANAL
+	#endif
+	#ifndef PIX_MA_G
+		#define PIX_MA_G		PIX_MA_CANAL
+	#endif
+	#ifndef PIX_MA_B
+		#define PIX_MA_B		PIX_MA_CANAL
+	#endif
+	#if (PIX_MA_R == 0) || (PIX_MA_G == 0) || (PIX_MA_B == 0) || (PIX_MA_R > 255) || (PIX_MA_G > 255) || (PIX_MA_B > 255)
+		#error "PIX_MA_R/G/B tienen que estar entre 1 y 255 mA"
+	#endif
+	#if PIX_MAX_MA <= (PIX_NUM_LEDS * PIX_MA_REPOSO)
+		#error "PIX_MAX_MA no cubre ni el consumo en reposo de los LEDs"
+	#endif
+#endif
+
+#ifdef PIX_POWER_PIN
+	#ifndef PIX_AHORRO
+		#define PIX_AHORRO		//solo se corta la alimentacion con la tira en negro
+	#endif
+	#ifndef PIX_POWER_US
+		#define PIX_POWER_US	1000
+	#endif
+	#ifdef PIX_POWER_BAJO
+		#define PIX_POWER_ON()	output_low(PIX_POWER_PIN)
+		#define PIX_POWER_OFF()	output_high(PIX_POWER_PIN)
+	#else
+		#define PIX_POWER_ON()	output_high(PIX_POWER_PIN)
+		#define PIX_POWER_OFF()	output_low(PIX_POWER_PIN)
+	#endif
+#endif
+
+#ifdef PIX_DORMIR
+	#if defined(PIX_APA102) || defined(PIX_DMA)
+		#error "PIX_DORMIR es para la espera del reset del envio por pin"
+	#endif
+	#if !getenv("BIT_VALID:IDLEN")
+		#error "PIX_DORMIR necesita modo IDLE (bit IDLEN): con SLEEP normal el Timer2 se para"
+	#endif
+	#ifndef PIX_DELAY_TIMER2
+		#define PIX_DELAY_TIMER2	//el Timer2 cuenta el reset y despierta al PIC
+	#endif
+#endif
+
+#ifdef PIX_LUT
+	#ifndef PIX_BALANCE_R
+		#define PIX_BALANCE_R	255
+	#endif
+	#ifndef PIX_BALANCE_G
+		#define PIX_BALANCE_G	255
+	#endif
+	#ifndef PIX_BALANCE_B
+		#define PIX_BALANCE_B	255
+	#endif
+	#if (PIX_NUM_LEDS * 3 + 768) > getenv("RAM")
+		#error "No hay RAM para las tablas de PIX_LUT (768 bytes)"
+	#endif
+#endif
+
 /* REGISTROS */
 #byte INDF0	= getenv("SFR:INDF0")
+#byte STATUS	= getenv("SFR:STATUS")	//C = bit 0, Z = bit 2
 #byte FSR0L	= getenv("SFR:FSR0L")
 #byte FSR0H	= getenv("SFR:FSR0H")
 #byte TMR2	= getenv("SFR:TMR2")
 #bit GIE	= getenv("BIT:GIE")
 #bit TMR2IF	= getenv("BIT:TMR2IF")
+#ifdef PIX_DORMIR
+#bit TMR2IE	= getenv("BIT:TMR2IE")
+#bit PEIE	= getenv("BIT:PEIE")
+#bit IDLEN	= getenv("BIT:IDLEN")
+#endif
+#ifdef PIX_DMA
+#byte DMASELECT	= getenv("SFR:DMASELECT")
+#byte DMAnCON0	= getenv("SFR:DMAnCON0")
+#byte DMAnCON1	= getenv("SFR:DMAnCON1")
+#byte DMAnSIRQ	= getenv("SFR:DMAnSIRQ")
+#byte DMAnAIRQ	= getenv("SFR:DMAnAIRQ")
+#word DMAnSSA	= getenv("SFR:DMAnSSAL")	//parte U aparte
+#byte DMAnSSAU	= getenv("SFR:DMAnSSAU")
+#word DMAnSSZ	= getenv("SFR:DMAnSSZL")
+#word DMAnDSA	= getenv("SFR:DMAnDSAL")
+#word DMAnDSZ	= getenv("SFR:DMAnDSZL")
+#byte SPI1CON0	= getenv("SFR:SPI1CON0")
+#byte SPI1CON1	= getenv("SFR:SPI1CON1")
+#byte SPI1CON2	= getenv("SFR:SPI1CON2")
+#byte SPI1BAUD	= getenv("SFR:SPI1BAUD")
+#byte SPI1CLK	= getenv("SFR:SPI1CLK")
+#byte SPI1TXB	= getenv("SFR:SPI1TXB")
+#byte CLCSELECT	= getenv("SFR:CLCSELECT")
+#byte CLCnCON	= getenv("SFR:CLCnCON")
+#byte CLCnPOL	= getenv("SFR:CLCnPOL")
+#byte CLCnSEL0	= getenv("SFR:CLCnSEL0")
+#byte CLCnSEL1	= getenv("SFR:CLCnSEL1")
+#byte CLCnSEL2	= getenv("SFR:CLCnSEL2")
+#byte CLCnSEL3	= getenv("SFR:CLCnSEL3")
+#byte CLCnGLS0	= getenv("SFR:CLCnGLS0")
+#byte CLCnGLS1	= getenv("SFR:CLCnGLS1")
+#byte CLCnGLS2	= getenv("SFR:CLCnGLS2")
+#byte CLCnGLS3	= getenv("SFR:CLCnGLS3")
+#byte DMA1PR	= getenv("SFR:DMA1PR")
+#byte PRLOCK	= getenv("SFR:PRLOCK")
+#byte T4CON		= getenv("SFR:T4CON")
+#byte T4HLT		= getenv("SFR:T4HLT")
+#byte T4CLKCON	= getenv("SFR:T4CLKCON")
+#byte T4TMR		= getenv("SFR:T4TMR")
+#byte T4PR		= getenv("SFR:T4PR")
+#endif
+#ifdef __PCH__
+#byte POSTINC0	= getenv("SFR:POSTINC0")
+#byte PRODL	= getenv("SFR:PRODL")	//contador de bytes del bucle de envio
+#byte PRODH	= getenv("SFR:PRODH")
+#endif
 
 /* DEFINES */
 #define PIX_NUM_BYTES	(PIX_NUM_LEDS * 3)
 
+/* PRESUPUESTO DE TIEMPO */
+#define PIX_MHZ		(getenv("CLOCK") / 1000000)
+
+#ifdef PIX_APA102
+	//spi_write() espera a que salga cada byte: 8 bits de SCK mas la carga del
+	//siguiente. Estimado para SPI_CLK_DIV_4; con otro divisor hay que definirlo
+	#ifndef PIX_APA102_BYTE_CICLOS
+		#define PIX_APA102_BYTE_CICLOS	48
+	#endif
+	#define PIX_ENVIO_US	(((PIX_APA102_INICIO + PIX_NUM_LEDS * 4 + PIX_APA102_FIN) * PIX_APA102_BYTE_CICLOS * 4 + PIX_MHZ - 1) / PIX_MHZ)
+	#define PIX_RESET_US	0
+	#define PIX_IRQ_OFF_US	0	//el envio no desactiva las interrupciones
+#elif defined(PIX_DMA)
+	#define PIX_BIT_NS		(2 * PIX_DMA_T1H_NS)
+	#define PIX_ENVIO_US	((PIX_NUM_BYTES * PIX_BIT_NS + 124) / 125)
+	#define PIX_RESET_US	50
+	#define PIX_IRQ_OFF_US	0	//lo hace el DMA
+#else
+	//Ciclos de instruccion por bit y ciclos de mas en cada cambio de byte
+	//(PIX_BYTE_EXTRA), los que mide tools/pix_genbucle.c -e en el codigo de
+	//led_pixels_envio.c y led_pixels_gen.c, y los de led_pixels_gen18.c.
+	//Todos los bucles son de forma A: el control del bucle va en el nivel
+	//bajo del bit 0 sin alargarlo, asi que en PIC16 PIX_BYTE_EXTRA es 0
+	#if getenv("CLOCK") == 16000000
+		#define PIX_BIT_CICLOS	10
+	#elif getenv("CLOCK") == 20000000
+		#ifdef PIX_800KHZ
+			#define PIX_BIT_CICLOS	8	//625KHz
+		#else
+			#define PIX_BIT_CICLOS	12	//417KHz
+		#endif
+	#elif getenv("CLOCK") == 24000000
+		#define PIX_BIT_CICLOS	15
+	#elif getenv("CLOCK") == 32000000
+		#ifdef PIX_800KHZ
+			#define PIX_BIT_CICLOS	10
+		#else
+			#define PIX_BIT_CICLOS	20
+		#endif
+	#elif getenv("CLOCK") == 40000000
+		#ifdef PIX_800KHZ
+			#define PIX_BIT_CICLOS	12	//833KHz
+		#else
+			#define PIX_BIT_CICLOS	25
+		#endif
+	#elif getenv("CLOCK") == 48000000
+		#ifdef PIX_800KHZ
+			#define PIX_BIT_CICLOS	15
+		#elif defined(__PCH__)
+			#define PIX_BIT_CICLOS	30
+		#else
+			#define PIX_BIT_CICLOS	32	//375KHz, deja sitio a PIX_HUECO
+		#endif
+	#elif getenv("CLOCK") == 64000000
+		#ifdef PIX_800KHZ
+			#define PIX_BIT_CICLOS	20
+		#else
+			#define PIX_BIT_CICLOS	40
+		#endif
+	#endif
+	
+	#define PIX_BYTE_EXTRA	0
+	
+	#ifdef PIX_BIT_CICLOS
+		#define PIX_BIT_NS		((PIX_BIT_CICLOS * 4000) / PIX_MHZ)
+		#define PIX_BYTE_CICLOS	(PIX_BIT_CICLOS * 8 + PIX_BYTE_EXTRA)
+		#ifdef __PCH__
+			//2 ciclos mas cada 256 bytes para decrementar PRODH
+			#define PIX_ENVIO_US	((PIX_NUM_BYTES * PIX_BYTE_CICLOS * 4 + (PIX_NUM_BYTES >> 8) * 8 + PIX_MHZ - 1) / PIX_MHZ)
+		#else
+			#define PIX_ENVIO_US	((PIX_NUM_BYTES * PIX_BYTE_CICLOS * 4 + PIX_MHZ - 1) / PIX_MHZ)
+		#endif
+		#define PIX_RESET_US	50
+		//Los 50uS se esperan con las interrupciones desactivadas: despues del
+		//envio con delay_us() o antes, en el peor caso, con PIX_DELAY_TIMER2
+		#define PIX_IRQ_OFF_US	(PIX_ENVIO_US + PIX_RESET_US)
+	#endif
+#endif
+
+#ifdef PIX_ENVIO_US
+	#define PIX_FRAME_US	(PIX_ENVIO_US + PIX_RESET_US)
+	#define PIX_MAX_FPS		(1000000 / PIX_FRAME_US)
+	
+	#if defined(PIX_TARGET_FPS) && ((PIX_FRAME_US * PIX_TARGET_FPS) > 1000000)
+		#error "PIX_TARGET_FPS inalcanzable: menos LEDs, 800KHz o mas frecuencia de reloj"
+	#endif
+	#if defined(PIX_MAX_IRQ_US) && (PIX_IRQ_OFF_US > PIX_MAX_IRQ_US)
+		#error "MostrarPixels() desactiva las interrupciones mas de PIX_MAX_IRQ_US: menos LEDs, 800KHz, PIX_DMA o PIX_APA102"
+	#endif
+#elif defined(PIX_TARGET_FPS) || defined(PIX_MAX_IRQ_US)
+	#error "No se conoce el bucle de envio a esta frecuencia: no se puede comprobar PIX_TARGET_FPS ni PIX_MAX_IRQ_US"
+#endif
+
+/* HUECO PARA EL PROGRAMA EN EL BUCLE DE ENVIO */
+#define PIX_HUECO_MAX	17	//ciclos en bajo del bit 7 a 48MHz / 400KHz ([15]-[31])
+#ifdef PIX_HUECO
+	#ifndef PIX_HUECO_CICLOS
+		#error "Define PIX_HUECO_CICLOS con los ciclos que tarda PIX_HUECO"
+	#endif
+	//a 800KHz no hay hueco: la tira principal tiene que ir a 400KHz (PIX_400KHZ)
+	#if (getenv("CLOCK") != 48000000) || defined(__PCH__) || defined(PIX_RELOJ_GENERADO) || defined(PIX_APA102) || defined(PIX_DMA) || defined(PIX_800KHZ)
+		#error "PIX_HUECO solo existe en el bucle de 48MHz / 400KHz de PIC16"
+	#endif
+	#if (PIX_HUECO_CICLOS < 1) || (PIX_HUECO_CICLOS > PIX_HUECO_MAX)
+		#error "PIX_HUECO no cabe: PIX_HUECO_CICLOS tiene que estar entre 1 y 17"
+	#endif
+#endif
+
+/* TIPOS */
+//Indice de LED y contador de bytes: int mientras quepan, long si no
+#if PIX_NUM_LEDS > 255
+typedef long PixIndice;
+#else
+typedef int PixIndice;
+#endif
+#if PIX_NUM_BYTES > 255
+typedef long PixNumByte;
+#else
+typedef int PixNumByte;
+#endif
+
 /* COLORES BASICOS */
 //¡¡¡ Los colores cambian segun el voltaje que se aplique a los LEDs !!!
 #define PIX_NEGRO		0x000000	//negro
@@ -207,19 +812,271 @@
 #define PIX_VIOLETA		0xAC00FF	//violeta
 #define PIX_BLANCO		0xFFFFFF 	//blanco
 
+/* PERFILADO */
+#ifdef PIX_PROFILE
+	#byte TMR1L	= getenv("SFR:TMR1L")
+	#byte TMR1H	= getenv("SFR:TMR1H")
+	#bit TMR1IF	= getenv("BIT:TMR1IF")
+	
+	#ifndef PIX_PROFILE_DIV
+		#define PIX_PROFILE_DIV		1
+	#endif
+	#if PIX_PROFILE_DIV == 1
+		#define PIX_PROF_T1		T1_DIV_BY_1
+		#define PIX_PROF_DESP	0		//cuentas a ciclos: << PIX_PROF_DESP
+	#elif PIX_PROFILE_DIV == 2
+		#define PIX_PROF_T1		T1_DIV_BY_2
+		#define PIX_PROF_DESP	1
+	#elif PIX_PROFILE_DIV == 4
+		#define PIX_PROF_T1		T1_DIV_BY_4
+		#define PIX_PROF_DESP	2
+	#elif PIX_PROFILE_DIV == 8
+		#define PIX_PROF_T1		T1_DIV_BY_8
+		#define PIX_PROF_DESP	3
+	#else
+		#error "PIX_PROFILE_DIV tiene que ser 1, 2, 4 u 8"
+	#endif
+	
+	//El envio con GIE = 0 no lee el Timer1: solo puede desbordar una vez
+	#if defined(PIX_IRQ_OFF_US) && ((PIX_IRQ_OFF_US * (PIX_MHZ / 4)) >= (65536 * PIX_PROFILE_DIV))
+		#error "PIX_PROFILE no puede medir el envio con el Timer1: sube PIX_PROFILE_DIV"
+	#endif
+	
+	//Indices de los contadores
+	#define PIX_PROF_SET		0	//SetPixelColor (ambas versiones)
+	#define PIX_PROF_LLENAR		1	//LlenarDeColor
+	#define PIX_PROF_BRILLO		2	//CambiarBrillo
+	#define PIX_PROF_WHEEL		3	//Wheel
+	#define PIX_PROF_MOSTRAR	4	//MostrarPixels completo
+	#define PIX_PROF_IRQOFF		5	//tiempo con GIE=0 dentro de MostrarPixels
+	#define PIX_PROF_LIB		6	//contadores de la libreria
+	//el programa puede pedir contadores propios, desde PIX_PROF_LIB
+	#ifndef PIX_PROF_EXTRA
+		#define PIX_PROF_EXTRA	0
+	#endif
+	#define PIX_PROF_NUM		(PIX_PROF_LIB + PIX_PROF_EXTRA)
+	
+	typedef struct{
+		int32 Min;		//menor duracion medida (ciclos de instruccion)
+		int32 Max;		//mayor duracion medida
+		int32 Total;	//suma de todas las duraciones
+		long Llamadas;	//veces que se ha medido
+	}PixPerfil;
+	
+	//Una medida en curso: al empezar, el instante y el coste acumulado de las
+	//medidas terminadas hasta entonces; al parar, la duracion y el coste de
+	//las medidas de dentro
+	typedef struct{
+		int32 t;
+		int32 Gasto;
+	}PixMarca;
+	
+	//Marca de tiempo al entrar y acumulado al salir. (t) es una variable local.
+	//PIX_PROF_PARAR/PIX_PROF_SUMAR separan las dos mitades de PIX_PROF_FIN
+	//para acumular fuera de una zona con las interrupciones desactivadas
+	#define PIX_PROF_INICIO(t)		PixMarca t; PixPerfilMarcar(&t)
+	#define PIX_PROF_FIN(t, id)		PixPerfilAcumular(id, &t)
+	#define PIX_PROF_PARAR(t)		PixPerfilParar(&t)
+	#define PIX_PROF_SUMAR(t, id)	PixPerfilSumar(id, &t)
+#else
+	//Sin PIX_PROFILE las macros no generan codigo
+	#define PIX_PROF_INICIO(t)
+	#define PIX_PROF_FIN(t, id)
+	#define PIX_PROF_PARAR(t)
+	#define PIX_PROF_SUMAR(t, id)
+#endif
+
+/* SEGUIMIENTO DE CAMBIOS EN EL BUFFER */
+//Los setters llaman a PIX_CAMBIO_PIXEL() justo antes de escribir el LED (n),
+//con (p) apuntando a sus 3 bytes y (r, g, b) ya escalados por el brillo.
+//Las funciones que modifican el buffer en bloque llaman a PIX_BUFFER_TOCADO()
+//y lo que dependa del contenido se recalcula en el siguiente MostrarPixels()
+//Todas son una sola sentencia (do{ }while(0)), se pueden usar en un if sin llaves
+
+//Posicion de cada canal dentro de los 3 bytes de un LED
+#ifdef PIX_RGB
+	#define PIX_POS_R	0
+	#define PIX_POS_G	1
+	#define PIX_POS_B	2
+#elif defined(PIX_BGR)
+	#define PIX_POS_R	2
+	#define PIX_POS_G	1
+	#define PIX_POS_B	0
+#else
+	#define PIX_POS_R	1
+	#define PIX_POS_G	0
+	#define PIX_POS_B	2
+#endif
+
+#ifdef PIX_MAX_MA
+	#if (PIX_MA_R == PIX_MA_G) && (PIX_MA_G == PIX_MA_B)
+		//Mismo consumo en los tres canales: suma de todos los bytes del buffer
+		#define PIX_SUMA_MAX	((int32)(PIX_MAX_MA - (PIX_NUM_LEDS * PIX_MA_REPOSO)) * 255 / PIX_MA_R)
+		#define PIX_SUMA_PIXEL(p, r, g, b)	do{ \
+											PixSumaColor -= (long)(p)[0] + (p)[1] + (p)[2]; \
+											PixSumaColor += (long)(r) + (g) + (b); \
+										}while(0)
+	#else
+		//Consumo distinto por canal: cada byte pesa los mA de su canal a 255.
+		//Cuesta tres multiplicaciones de 8x8 mas por LED escrito
+		#define PIX_SUMA_PESOS
+		#define PIX_SUMA_MAX	((int32)(PIX_MAX_MA - (PIX_NUM_LEDS * PIX_MA_REPOSO)) * 255)
+		#define PIX_SUMA_PIXEL(p, r, g, b)	do{ \
+											PixSumaColor -= (int32)_mul((p)[PIX_POS_R], PIX_MA_R) + _mul((p)[PIX_POS_G], PIX_MA_G) + _mul((p)[PIX_POS_B], PIX_MA_B); \
+											PixSumaColor += (int32)_mul((r), PIX_MA_R) + _mul((g), PIX_MA_G) + _mul((b), PIX_MA_B); \
+										}while(0)
+	#endif
+	#define PIX_SUMA_TOCADO()			do{ PixSumaValida = FALSE; }while(0)
+#else
+	#define PIX_SUMA_PIXEL(p, r, g, b)	do{ }while(0)
+	#define PIX_SUMA_TOCADO()			do{ }while(0)
+#endif
+
+#ifdef PIX_AHORRO
+	//Cuenta de LEDs encendidos: resta si el LED estaba encendido y suma si lo va a estar
+	#define PIX_ENC_PIXEL(p, r, g, b)	do{ \
+											if((p)[0] | (p)[1] | (p)[2]) PixEncendidos--; \
+											if((r) | (g) | (b)) PixEncendidos++; \
+										}while(0)
+	#define PIX_ENC_TOCADO()			do{ PixEncendidosValido = FALSE; }while(0)
+#else
+	#define PIX_ENC_PIXEL(p, r, g, b)	do{ }while(0)
+	#define PIX_ENC_TOCADO()			do{ }while(0)
+#endif
+
+#ifdef PIX_PREFIJO
+	//LED mas alto escrito desde el ultimo envio: MostrarPixels() envia hasta ahi
+	#define PIX_TOPE_PIXEL(n)			do{ if((n) >= PixTope) PixTope = (n) + 1; }while(0)
+	#define PIX_TOPE_TOCADO()			do{ PixTope = PIX_NUM_LEDS; }while(0)
+#else
+	#define PIX_TOPE_PIXEL(n)			do{ }while(0)
+	#define PIX_TOPE_TOCADO()			do{ }while(0)
+#endif
+
+//(r, g, b) siempre en orden RGB, sea cual sea el orden de (p) en el buffer
+#define PIX_CAMBIO_PIXEL(n, p, r, g, b)	do{ \
+											PIX_SUMA_PIXEL(p, r, g, b); \
+											PIX_ENC_PIXEL(p, r, g, b); \
+											PIX_TOPE_PIXEL(n); \
+										}while(0)
+
+/* AJUSTE DE COLOR */
+//Los setters pasan cada canal por PIX_AJUSTAR() antes de guardarlo. Es una
+//sola sentencia en las dos versiones (do{ }while(0)), igual que las de arriba
+#ifdef PIX_LUT
+	//balance de blancos, curva y brillo ya juntos en una tabla por canal
+	#define PIX_AJUSTAR(r, g, b)	do{ \
+										r = PixLUTR[r]; \
+										g = PixLUTG[g]; \
+										b = PixLUTB[b]; \
+									}while(0)
+#else
+	//r * Brillo / 256 con Escalar8() (multiplicacion desenrollada o MULWF)
+	#define PIX_AJUSTAR(r, g, b)	do{ \
+										if(Brillo != 0){ \
+											r = Escalar8(r, Brillo); \
+											g = Escalar8(g, Brillo); \
+											b = Escalar8(b, Brillo); \
+										} \
+									}while(0)
+#endif
+#define PIX_BUFFER_TOCADO()				do{ \
+											PIX_SUMA_TOCADO(); \
+											PIX_ENC_TOCADO(); \
+											PIX_TOPE_TOCADO(); \
+										}while(0)
+
 /* VARIABLES */
 int Pixels[PIX_NUM_BYTES];	//Array donde se guardan los valores de los leds
 int Brillo = 0;				//Permite ajustar el brillo sin modificar el color
+#ifdef PIX_APA102
+int PixBrillo5 = 31;		//Brillo global de 5 bits que va en la cabecera de cada LED
+#endif
+#ifdef PIX_LUT
+int PixLUTR[256];			//valor a guardar para cada valor de rojo
+int PixLUTG[256];
+int PixLUTB[256];
+int PixBalance[3] = {PIX_BALANCE_R, PIX_BALANCE_G, PIX_BALANCE_B};
+#endif
+#ifdef PIX_DMA
+short PixEnviando = FALSE;	//TRUE desde MostrarPixels() hasta el final del reset de 50uS
+#endif
+
+#ifdef PIX_MAX_MA
+#if (PIX_NUM_BYTES > 257) || defined(PIX_SUMA_PESOS)
+int32 PixSumaColor = 0;			//Suma de todos los bytes de Pixels[] (con PIX_SUMA_PESOS, por mA)
+#else
+long PixSumaColor = 0;			//Suma de todos los bytes de Pixels[] (cabe en 16 bits)
+#endif
+short PixSumaValida = FALSE;	//FALSE: hay que recalcular PixSumaColor
+int PixLimiteEscala = 0;		//escala de la ultima vez que PixLimitarConsumo() recorto el buffer
+#endif
+
+#ifdef PIX_AHORRO
+PixIndice PixEncendidos = 0;		//LEDs con algun canal distinto de 0
+short PixEncendidosValido = FALSE;	//FALSE: hay que recontar PixEncendidos
+short PixApagada = FALSE;			//TRUE: ya se ha enviado la trama negra, no se envia mas
+#endif
+
+#ifdef PIX_PREFIJO
+PixIndice PixTope = PIX_NUM_LEDS;	//LEDs a enviar en el proximo MostrarPixels()
+#endif
+
+#ifdef PIX_PROFILE
+PixPerfil PixPerfiles[PIX_PROF_NUM];	//Contadores de cada funcion
+long PixPerfilSesgo = 0;				//Ciclos que cuesta la propia medida
+long PixPerfilCoste = 0;				//Ciclos que añade cada medida de dentro a la de fuera
+long PixPerfilVueltas = 0;				//Desbordes del Timer1: 16 bits altos del contador
+int32 PixPerfilGasto = 0;				//PixPerfilCoste acumulado de las medidas terminadas
+#endif
 
 /* PROTOTIPOS */
 void InitPixels(void);
-void SetPixelColor(int n, int r, int g, int b);
-void SetPixelColor(int n, int32 c);
+void SetPixelColor(PixIndice n, int r, int g, int b);
+void SetPixelColor(PixIndice n, int32 c);
 int32 Color32(int r, int g, int b);
 int32 Wheel(int WheelPos);
 void CambiarBrillo(int b);
-void LlenarDeColor(int from, int to, int32 c);
+void PixEscalarBuffer(int *ptr, long Bytes, int Anterior, int Nuevo);
+int Escalar8(int v, int s);
+int Sumar8(int a, int b);
+int Restar8(int a, int b);
+int Mezclar8(int a, int b, int t);
+void PixEscalarBytes(int *ptr, long Bytes, int s);
+void AtenuarPixels(int Escala);
+void FundirANegro(int Cantidad);
+int32 GetPixelColor(PixIndice n);
+void PixPrepararColor(int32 c, int *Col);
+void LlenarDeColor(PixIndice from, PixIndice to, int32 c);
 void MostrarPixels(void);
+void MostrarPixelsHasta(PixIndice Leds);
+#ifdef PIX_MAX_MA
+void PixSumarBuffer(void);
+short PixLimitarConsumo(void);
+#endif
+#ifdef PIX_AHORRO
+void PixContarEncendidos(void);
+#endif
+#ifdef PIX_LUT
+void PixLUTCalcular(void);
+void SetBalance(int r, int g, int b);
+#ifdef PIX_LUT_EEPROM
+void GuardarBalance(void);
+#endif
+#endif
+#ifdef PIX_DMA
+void PixDMAFin(void);
+void PixDMALatch(void);
+#endif
+#ifdef PIX_PROFILE
+int32 PixPerfilLeer(void);
+void PixPerfilMarcar(PixMarca *m);
+void PixPerfilParar(PixMarca *m);
+void PixPerfilSumar(int id, PixMarca *m);
+void PixPerfilAcumular(int id, PixMarca *m);
+void PixPerfilReiniciar(void);
+void PixPerfilImprimir(void);
+#endif
 
 #endif	/* LED_PIXELS_H */
 
@@ -0,0 +1,37 @@
+/* 
+ * File:   led_pixels_apa102.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Envio de la trama APA102/SK9822 por SPI. Se incluye desde MostrarPixels()
+ * con el contador i (int) declarado, igual que led_pixels_envio.c, y desde
+ * tools/pix_apa102.c en el PC con spi_write() guardando los bytes, para
+ * comprobar la trama sin el PIC. El formato esta en led_pixels_apa102.h.
+ * 
+ * Protocolo de dos hilos con reloj: no hay tiempos criticos y las
+ * interrupciones siguen activas. Se envia siempre la tira entera: la trama de
+ * fin tiene que llegar hasta el ultimo LED. El buffer ya esta en orden B, G, R
+ * (PIX_BGR), asi que cada LED es la cabecera y sus 3 bytes tal cual.
+ * ---------------------------------------------------------------------------*/
+
+	int *ptr = Pixels;
+	int Cabecera = PIX_APA102_CABECERA | PixBrillo5;
+	PixIndice n;
+	
+	for(i = 0; i < PIX_APA102_INICIO; i++){
+		spi_write(0x00);	//trama de inicio
+	}
+	
+	for(n = 0; n < PIX_NUM_LEDS; n++){
+		spi_write(Cabecera);
+		spi_write(*ptr++);
+		spi_write(*ptr++);
+		spi_write(*ptr++);
+	}
+	
+	for(i = 0; i < PIX_APA102_FIN; i++){
+		spi_write(0x00);	//trama de fin
+	}
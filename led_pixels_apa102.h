@@ -0,0 +1,27 @@
+/*
+ * File:   led_pixels_apa102.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Formato de la trama APA102/SK9822. Solo son #define, asi que lo incluyen
+ * tanto led_pixels.h en el PIC como tools/pix_apa102.c en el PC, que comprueba
+ * el envio (led_pixels_apa102.c) con el mismo formato.
+ *
+ * Trama: PIX_APA102_INICIO bytes a 0, por cada LED la cabecera
+ * PIX_APA102_CABECERA | brillo (5 bits) y los colores B, G, R, y al final
+ * PIX_APA102_FIN_N(n) bytes a 0: 32 bits para el reset del SK9822 mas medio
+ * bit por LED para que el ultimo de la cadena reciba los flancos de reloj que
+ * le faltan, redondeado a bytes.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_APA102_H
+#define	LED_PIXELS_APA102_H
+
+#define PIX_APA102_INICIO		4		//bytes a 0 de la trama de inicio
+#define PIX_APA102_CABECERA		0xE0	//3 bits a 1 delante del brillo de cada LED
+#define PIX_APA102_FIN_N(n)		(4 + (((n) + 15) / 16))	//bytes a 0 de la trama de fin
+
+#endif	/* LED_PIXELS_APA102_H */
@@ -0,0 +1,125 @@
+#include <led_pixels_audio.h>
+#include "led_pixels_goertzel.c"
+
+/*
+ * Interrupcion del Timer 0: guarda la conversion que acaba de terminar y
+ * lanza la siguiente. Se recarga sumando para no acumular la latencia
+ */
+#INT_TIMER0
+void PixAudioISR(void){
+	set_timer0(get_timer0() + (256 - PIX_AUDIO_CUENTA));
+
+	if(PixAudioPos < PIX_AUDIO_N){
+		PixAudioMuestras[PixAudioPos++] = read_adc(ADC_READ_ONLY) ^ 0x80;	//0-255 a -128..127
+		read_adc(ADC_START_ONLY);
+	}
+}
+
+/*
+ * Configura el Timer 0, calcula los coeficientes y empieza el primer bloque
+ */
+void InitAudio(void){
+	PixAudioCoefs[0] = PixAudioCoef(PIX_AUDIO_BANDA1, PIX_AUDIO_HZ);
+#if PIX_AUDIO_BANDAS > 1
+	PixAudioCoefs[1] = PixAudioCoef(PIX_AUDIO_BANDA2, PIX_AUDIO_HZ);
+#endif
+#if PIX_AUDIO_BANDAS > 2
+	PixAudioCoefs[2] = PixAudioCoef(PIX_AUDIO_BANDA3, PIX_AUDIO_HZ);
+#endif
+#if PIX_AUDIO_BANDAS > 3
+	PixAudioCoefs[3] = PixAudioCoef(PIX_AUDIO_BANDA4, PIX_AUDIO_HZ);
+#endif
+
+#ifdef __PCH__
+	setup_timer_0(T0_INTERNAL | T0_DIV_8 | T0_8_BIT);
+#else
+	setup_timer_0(RTCC_INTERNAL | RTCC_DIV_8);
+#endif
+	ReanudarAudio();
+}
+
+/*
+ * TRUE cuando el bloque esta lleno (el muestreo esta parado)
+ */
+short AudioListo(void){
+	return PixAudioPos >= PIX_AUDIO_N;
+}
+
+/*
+ * Empieza un bloque nuevo
+ */
+void ReanudarAudio(void){
+	disable_interrupts(INT_TIMER0);
+	PixAudioPos = 0;
+	read_adc(ADC_START_ONLY);
+	set_timer0(256 - PIX_AUDIO_CUENTA);
+	clear_interrupt(INT_TIMER0);
+	enable_interrupts(INT_TIMER0);
+}
+
+/*
+ * Analiza el bloque: volumen, niveles de las bandas y deteccion de golpes
+ * Un golpe es un bloque en el que la banda 1 supera su media lenta en
+ * PIX_AUDIO_UMBRAL (escala log: 8 = el doble de potencia)
+ */
+void AnalizarAudio(void){
+	PixAudioAnalizar(PixAudioMuestras, PIX_AUDIO_N, PixAudioCoefs, PIX_AUDIO_BANDAS, AudioNiveles, &AudioVolumen);
+
+	AudioGolpe = (AudioNiveles[0] > PixAudioMediaBajo) && ((AudioNiveles[0] - PixAudioMediaBajo) >= PIX_AUDIO_UMBRAL);
+
+	//media lenta: 7/8 de la anterior mas 1/8 del nivel nuevo
+	PixAudioMediaBajo = ((long)PixAudioMediaBajo * 7 + AudioNiveles[0]) >> 3;
+}
+
+/*
+ * Envia con el muestreo parado y empieza un bloque nuevo despues, para que
+ * el tiempo sin interrupciones de MostrarPixels() no quede dentro de un bloque
+ */
+void MostrarPixelsAudio(void){
+	disable_interrupts(INT_TIMER0);
+	MostrarPixels();
+	ReanudarAudio();
+}
+
+/*
+ * Vumetro: los primeros Nivel/256 LEDs del color (c), el resto apagados
+ */
+void VumetroPixels(int Nivel, int32 c){
+PixIndice n;
+
+	n = ((int32)Nivel * PIX_NUM_LEDS) >> 8;
+	if(n > 0) LlenarDeColor(0, n - 1, c);
+	if(n < PIX_NUM_LEDS) LlenarDeColor(n, PIX_NUM_LEDS - 1, PIX_NEGRO);
+}
+
+/*
+ * Un tramo por banda, con el color de la rueda de la banda y el brillo de su
+ * nivel. Un tono a fondo de escala da un nivel de 120-140, asi que se dobla
+ * y se satura para usar todo el brillo
+ */
+void BandasPixels(void){
+int k, Nivel;
+PixIndice Desde, Hasta;
+int32 c;
+
+	for(k = 0; k < PIX_AUDIO_BANDAS; k++){
+		Nivel = Sumar8(AudioNiveles[k], AudioNiveles[k]);
+
+		c = Wheel(((long)k << 8) / PIX_AUDIO_BANDAS);
+		c = Color32(Escalar8(make8(c, 2), Nivel), Escalar8(make8(c, 1), Nivel), Escalar8(make8(c, 0), Nivel));
+
+		Desde = ((int32)k * PIX_NUM_LEDS) / PIX_AUDIO_BANDAS;
+		Hasta = ((int32)(k + 1) * PIX_NUM_LEDS) / PIX_AUDIO_BANDAS;
+		if(Hasta > Desde) LlenarDeColor(Desde, Hasta - 1, c);
+	}
+}
+
+/*
+ * Destello del color (c) con cada golpe; entre golpes se apaga poco a poco
+ */
+void PulsoPixels(int32 c){
+	if(AudioGolpe)
+		LlenarDeColor(0, PIX_NUM_LEDS - 1, c);
+	else
+		FundirANegro(PIX_AUDIO_CAIDA);
+}
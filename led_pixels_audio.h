@@ -0,0 +1,153 @@
+/*
+ * File:   led_pixels_audio.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Efectos que reaccionan al sonido: vumetro, bandas de frecuencia y pulsos
+ * con cada golpe de bajo.
+ *
+ * El Timer 0 (modo 8 bits, divisor 8) interrumpe a PIX_AUDIO_HZ y en cada
+ * interrupcion se guarda la conversion anterior del ADC y se lanza la
+ * siguiente, asi que las muestras estan equiespaciadas aunque el programa
+ * este ocupado. Cuando el bloque de PIX_AUDIO_N muestras esta lleno se deja
+ * de muestrear hasta analizarlo.
+ *
+ * MostrarPixels() desactiva las interrupciones y dejaria un hueco en mitad
+ * del bloque. Por eso se usa MostrarPixelsAudio(): para el muestreo, envia y
+ * empieza un bloque nuevo, sin mezclar muestras de antes y despues del envio.
+ *
+ * El analisis (led_pixels_goertzel.c) saca el volumen y la energia de hasta
+ * 4 bandas con filtros de Goertzel enteros. Es C estandar: tools/pix_audio.c
+ * lo compila en el PC y lo pasa por archivos WAV.
+ *
+ * El ADC lo configura el programa (canal, reloj, referencia) con resultado
+ * de 8 bits: #device ADC=8. El microfono va centrado a media tension.
+ * ----------------------------------------------------------------------------
+ *
+ * Uso:
+ * #device ADC=8
+ * #define PIX_AUDIO_HZ			8000	//muestras por segundo (por defecto 8000)
+ * #define PIX_AUDIO_N			64		//muestras por bloque (por defecto 64)
+ * #define PIX_AUDIO_BANDAS		4		//bandas (1-4, por defecto 4)
+ * #define PIX_AUDIO_BANDA1		125		//Hz de cada banda
+ * #include "led_pixels.c"
+ * #include "led_pixels_audio.c"
+ *
+ * setup_adc(ADC_CLOCK_DIV_32);
+ * setup_adc_ports(sAN2);
+ * set_adc_channel(2);
+ * InitAudio();
+ * enable_interrupts(GLOBAL);
+ * while(TRUE){
+ * 	if(AudioListo()){
+ * 		AnalizarAudio();
+ * 		BandasPixels();
+ * 		MostrarPixelsAudio();
+ * 	}
+ * }
+ * ---------------------------------------------------------------------------*/
+
+/* --------------------------------- FUNCIONES --------------------------------
+ *
+ * -InitAudio()
+ * Configura el Timer 0 y empieza a muestrear
+ *
+ * -AudioListo()
+ * TRUE cuando hay un bloque completo para analizar
+ *
+ * -AnalizarAudio()
+ * Calcula AudioVolumen, AudioNiveles[] y AudioGolpe a partir del bloque
+ *
+ * -MostrarPixelsAudio()
+ * MostrarPixels() sin romper el muestreo. Empieza un bloque nuevo
+ *
+ * -ReanudarAudio()
+ * Empieza un bloque nuevo sin enviar (si no se muestra cada bloque)
+ *
+ * -VumetroPixels(int Nivel, int32 c)
+ * Enciende con el color (c) una parte de la tira proporcional a Nivel (0-255)
+ *
+ * -BandasPixels()
+ * Divide la tira en un tramo por banda, cada uno con su color de Wheel() y
+ * con el brillo de su nivel
+ *
+ * -PulsoPixels(int32 c)
+ * Con cada golpe enciende toda la tira del color (c); entre golpes la funde
+ * hacia negro
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_AUDIO_H
+#define	LED_PIXELS_AUDIO_H
+
+#ifndef PIX_AUDIO_HZ
+	#define PIX_AUDIO_HZ		8000
+#endif
+#ifndef PIX_AUDIO_N
+	#define PIX_AUDIO_N			64
+#endif
+#ifndef PIX_AUDIO_BANDAS
+	#define PIX_AUDIO_BANDAS	4
+#endif
+#ifndef PIX_AUDIO_BANDA1
+	#define PIX_AUDIO_BANDA1	125		//bajo (golpes)
+#endif
+#ifndef PIX_AUDIO_BANDA2
+	#define PIX_AUDIO_BANDA2	500
+#endif
+#ifndef PIX_AUDIO_BANDA3
+	#define PIX_AUDIO_BANDA3	1000
+#endif
+#ifndef PIX_AUDIO_BANDA4
+	#define PIX_AUDIO_BANDA4	2500
+#endif
+#ifndef PIX_AUDIO_UMBRAL
+	#define PIX_AUDIO_UMBRAL	16		//golpe: bajo 6dB por encima de su media
+#endif
+#ifndef PIX_AUDIO_CAIDA
+	#define PIX_AUDIO_CAIDA		40		//FundirANegro() entre golpes
+#endif
+
+#if (PIX_AUDIO_N < 8) || (PIX_AUDIO_N > 128)
+	#error "PIX_AUDIO_N tiene que estar entre 8 y 128"
+#endif
+#if (PIX_AUDIO_BANDAS < 1) || (PIX_AUDIO_BANDAS > 4)
+	#error "PIX_AUDIO_BANDAS tiene que estar entre 1 y 4"
+#endif
+
+//Cuentas del Timer 0 (Fosc/4 con divisor 8) por muestra
+#define PIX_AUDIO_CUENTA	(getenv("CLOCK") / 32 / PIX_AUDIO_HZ)
+#if (PIX_AUDIO_CUENTA > 256) || (PIX_AUDIO_CUENTA < 40)
+	#error "PIX_AUDIO_HZ fuera de rango para esta frecuencia de reloj"
+#endif
+
+/* TIPOS */
+//Tipos del nucleo de analisis, que tambien compila en el PC
+typedef int PixU8;
+typedef signed int PixS8;
+typedef signed long PixS16;
+typedef int32 PixU32;
+typedef signed int32 PixS32;
+
+/* VARIABLES */
+PixS8 PixAudioMuestras[PIX_AUDIO_N];	//bloque actual, ya con signo
+int PixAudioPos = PIX_AUDIO_N;			//muestras guardadas; N = bloque lleno
+PixS16 PixAudioCoefs[PIX_AUDIO_BANDAS];	//2cos(w) de cada banda en Q12
+int AudioVolumen = 0;					//0-255
+int AudioNiveles[PIX_AUDIO_BANDAS];		//energia de cada banda, log (8 = x2)
+short AudioGolpe = FALSE;				//TRUE en el bloque con un golpe de bajo
+int PixAudioMediaBajo = 0;				//media lenta del nivel de la banda 1
+
+/* PROTOTIPOS */
+void InitAudio(void);
+short AudioListo(void);
+void AnalizarAudio(void);
+void ReanudarAudio(void);
+void MostrarPixelsAudio(void);
+void VumetroPixels(int Nivel, int32 c);
+void BandasPixels(void);
+void PulsoPixels(int32 c);
+
+#endif	/* LED_PIXELS_AUDIO_H */
@@ -0,0 +1,108 @@
+#include <led_pixels_capas.h>
+
+/*
+ * Posicion del punto del LED n en la capa, o PixCapaNum si no esta
+ */
+int PixCapaBuscar(PixIndice n){
+int k;
+
+	for(k = 0; k < PixCapaNum; k++){
+		if(PixCapa[k].n == n) break;
+	}
+	return k;
+}
+
+/*
+ * Pone o cambia el punto del LED n. Alfa = 0 lo quita
+ */
+short CapaPixel(PixIndice n, int32 c, int Alfa){
+int k;
+
+	if(n >= PIX_NUM_LEDS) return FALSE;
+	if(Alfa == 0){
+		QuitarCapaPixel(n);
+		return TRUE;
+	}
+
+	k = PixCapaBuscar(n);
+	if(k == PixCapaNum){
+		if(PixCapaNum == PIX_CAPA_MAX) return FALSE;	//llena
+		PixCapaNum++;
+		PixCapa[k].n = n;
+	}
+
+	PixCapa[k].Color = c;		//se ajusta al enviar, con el brillo de ese momento
+	PixCapa[k].Alfa = Alfa;
+	return TRUE;
+}
+
+/*
+ * Quita el punto del LED n. El ultimo pasa a ocupar su hueco
+ */
+void QuitarCapaPixel(PixIndice n){
+int k;
+
+	k = PixCapaBuscar(n);
+	if(k == PixCapaNum) return;
+
+	PixCapaNum--;
+	if(k != PixCapaNum) PixCapa[k] = PixCapa[PixCapaNum];
+}
+
+void BorrarCapa(void){
+	PixCapaNum = 0;
+}
+
+/*
+ * Mezcla la capa con el fondo, envia y restaura el fondo. Los cambios pasan
+ * por PIX_CAMBIO_PIXEL, asi que la suma de PIX_MAX_MA y la cuenta de
+ * PIX_AHORRO siguen al dia sin recorrer el buffer
+ */
+void MostrarPixelsCapa(void){
+int k, j;
+int *p;
+int Col[3];
+PixCapaPunto *c;
+
+	for(k = 0; k < PixCapaNum; k++){
+		c = &PixCapa[k];
+		p = &Pixels[c->n * 3];
+
+		PixPrepararColor(c->Color, Col);	//con el brillo y el balance actuales
+		for(j = 0; j < 3; j++){
+			c->Fondo[j] = p[j];
+			if(c->Alfa != 255) Col[j] = Mezclar8(p[j], Col[j], c->Alfa);
+		}
+
+		PIX_CAMBIO_PIXEL(c->n, p, Col[PIX_POS_R], Col[PIX_POS_G], Col[PIX_POS_B]);
+		p[0] = Col[0];
+		p[1] = Col[1];
+		p[2] = Col[2];
+	}
+
+#ifdef PIX_MAX_MA
+	//el limitador escala el buffer para siempre: el fondo guardado tiene que
+	//quedar igual que el resto de la tira. MostrarPixels() ya no recorta mas
+	if(PixLimitarConsumo()){
+		for(k = 0; k < PixCapaNum; k++)
+			PixEscalarBytes(PixCapa[k].Fondo, 3, PixLimiteEscala);
+		PIX_TOPE_TOCADO();	//hay que enviar la tira entera
+	}
+#endif
+
+	MostrarPixels();
+
+#ifdef PIX_DMA
+	while(PixEnviando){delay_cycles(1);}	//el DMA sigue leyendo Pixels[]
+#endif
+
+	for(k = 0; k < PixCapaNum; k++){
+		c = &PixCapa[k];
+		p = &Pixels[c->n * 3];
+
+		PIX_CAMBIO_PIXEL(c->n, p, c->Fondo[PIX_POS_R], c->Fondo[PIX_POS_G], c->Fondo[PIX_POS_B]);
+		p[0] = c->Fondo[0];
+		p[1] = c->Fondo[1];
+		p[2] = c->Fondo[2];
+	}
+}
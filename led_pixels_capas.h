@@ -0,0 +1,90 @@
+/*
+ * File:   led_pixels_capas.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Capa superpuesta: unos pocos LEDs (indicadores de estado, cursores...) que
+ * se pintan encima de la animacion de Pixels[] con su propia transparencia,
+ * sin tocar la animacion. La animacion no hay que redibujarla cuando cambia
+ * la capa, ni guardar una copia en el programa.
+ *
+ * La capa es una lista de hasta PIX_CAPA_MAX puntos (LED, color, alfa). El
+ * color se guarda tal cual y MostrarPixelsCapa() lo ajusta (PIX_AJUSTAR) en
+ * cada envio, asi que sigue a CambiarBrillo() y SetBalance() como el resto
+ * de la tira. MostrarPixelsCapa() mezcla cada punto con el fondo, envia y
+ * deja el fondo como estaba: el coste es proporcional a los puntos de la
+ * capa, no a la longitud de la tira.
+ *
+ * Con PIX_MAX_MA el limitador se aplica con la capa ya mezclada y el fondo
+ * guardado se escala igual, asi que al restaurarlo no queda mas brillante
+ * que el resto de la tira.
+ *
+ * Alfa 255 tapa el fondo, 0 lo deja ver entero (y quita el punto).
+ *
+ * Con PIX_DMA espera al final del envio para restaurar el fondo, asi que
+ * MostrarPixelsCapa() no vuelve enseguida como MostrarPixels().
+ * ----------------------------------------------------------------------------
+ *
+ * Uso:
+ * #define PIX_CAPA_MAX		4		//puntos de la capa (por defecto 8)
+ * #include "led_pixels.c"
+ * #include "led_pixels_capas.c"
+ *
+ * CapaPixel(0, PIX_ROJO, 255);		//indicador opaco en el LED 0
+ * CapaPixel(1, PIX_AZUL, 128);		//medio transparente en el LED 1
+ * while(TRUE){
+ * 	LlenarRuido(0, 40, t++);		//la animacion pinta Pixels[] como siempre
+ * 	MostrarPixelsCapa();
+ * }
+ * ---------------------------------------------------------------------------*/
+
+/* --------------------------------- FUNCIONES --------------------------------
+ *
+ * -CapaPixel(PixIndice n, int32 c, int Alfa)
+ * Pone (o cambia) el punto del LED n con el color (c) y transparencia Alfa.
+ * Con Alfa = 0 lo quita. Devuelve FALSE si la capa esta llena
+ *
+ * -QuitarCapaPixel(PixIndice n)
+ * Quita el punto del LED n si existe
+ *
+ * -BorrarCapa()
+ * Quita todos los puntos
+ *
+ * -MostrarPixelsCapa()
+ * Mezcla la capa con Pixels[], llama a MostrarPixels() y deja Pixels[] como
+ * estaba. Sin puntos es igual que MostrarPixels()
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_CAPAS_H
+#define	LED_PIXELS_CAPAS_H
+
+#ifndef PIX_CAPA_MAX
+	#define PIX_CAPA_MAX	8
+#endif
+#if (PIX_CAPA_MAX < 1) || (PIX_CAPA_MAX > 255)
+	#error "PIX_CAPA_MAX tiene que estar entre 1 y 255"
+#endif
+
+/* TIPOS */
+typedef struct{
+	PixIndice n;	//LED
+	int32 Color;	//color sin ajustar (0xRRGGBB)
+	int Alfa;		//255 = opaco
+	int Fondo[3];	//bytes de Pixels[] mientras se envia
+}PixCapaPunto;
+
+/* VARIABLES */
+PixCapaPunto PixCapa[PIX_CAPA_MAX];
+int PixCapaNum = 0;		//puntos usados
+
+/* PROTOTIPOS */
+int PixCapaBuscar(PixIndice n);
+short CapaPixel(PixIndice n, int32 c, int Alfa);
+void QuitarCapaPixel(PixIndice n);
+void BorrarCapa(void);
+void MostrarPixelsCapa(void);
+
+#endif	/* LED_PIXELS_CAPAS_H */
@@ -0,0 +1,931 @@
+/* 
+ * File:   led_pixels_envio.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Bucles de envio WS281x para cada frecuencia de reloj. Se incluye desde
+ * MostrarPixels() y desde el envio de cada tira (led_pixels_tiras.c), con
+ * FSR0 apuntando al buffer, el numero de bytes en i (PRODH:PRODL en PIC18) y
+ * las interrupciones desactivadas.
+ * 
+ * El pin y la velocidad no se leen de la configuracion global sino de estas
+ * macros, que define quien lo incluye justo antes:
+ * PIX_ENV_PIN		pin de datos (bucles en C)
+ * PIX_ENV_PORT	direccion del puerto (bucles en ensamblador)
+ * PIX_ENV_BIT		bit del pin
+ * PIX_ENV_800		definida para 800KHz, sin definir para 400KHz
+ * 
+ * Las etiquetas son locales a cada funcion, asi que se puede incluir en
+ * varias funciones sin que choquen.
+ * ---------------------------------------------------------------------------*/
+
+#if defined(__PCH__)
+// ======================== ENVIO DE DATOS PIC18 =========================
+//Bucles generados con tools/pix_genbucle.c -18
+#include "led_pixels_gen18.c"
+
+#elif defined(PIX_RELOJ_GENERADO)
+// ============== ENVIO DE DATOS A 20MHZ, 40MHZ Y 64MHZ ===============
+//Bucles generados con tools/pix_genbucle.c
+#include "led_pixels_gen.c"
+
+#elif getenv("CLOCK") == 48000000
+// ==================== ENVIO DE DATOS A 48MHZ ====================
+//Bucles generados con tools/pix_genbucle.c
+
+#ifdef PIX_ENV_800
+//Envio de datos a 800Khz (48Mhz clock)
+// ---------------------------------------------------------------
+// Fosc = 48000000 Hz, Tcy = 83.33 ns, chip ws2812
+//         ciclos     ns     spec (ns)         margen
+// T0H        5    416.7      400 +-150         133.3
+// T1H       10    833.3      800 +-150         116.7
+// T0L       10    833.3
+// T1L        5    416.7
+// Periodo   15   1250.0     1250 +-600         600.0  (800 KHz)
+// Margen minimo: 116.7 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+#asm asis
+SendByte48_800:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 7		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 6		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 5		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 4		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 3		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 2		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 1		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 0		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	INCF	FSR0L, F		; [6] incrementar puntero
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	i, F			; [12] decrementar contador
+	GOTO	SendByte48_800	; [13] si no es cero, siguiente byte
+	; Fin de transmision
+#endasm
+
+#else
+//Envio de datos a 400Khz (48Mhz clock). El periodo es de 32 ciclos (375KHz)
+//en lugar de 30 para dejar 17 ciclos libres en el bit 7 (PIX_HUECO)
+// Con PIX_HUECO los 17 ciclos en bajo del bit 7 ([15]-[31]) ejecutan el
+// codigo del programa, una vez por byte (cada 21,3uS). Tiene que durar siempre
+// PIX_HUECO_CICLOS, volver con BSR en el banco de PIX_ENV_PORT y no tocar
+// FSR0 ni i. W y STATUS se pueden usar. Ejemplo de 14 ciclos: guardar lo que
+// llegue por la UART en una cola de 16 bytes en 0x20-0x2F (PIC16F1454 con
+// PIX_ENV_PORT en el banco 0 y la cabeza de la cola en la RAM comun, 0x70):
+//	CLRF	FSR1H			; FSR1 = 0x20 + cabeza
+//	MOVF	0x70, W
+//	ADDLW	0x20
+//	MOVWF	FSR1L
+//	BTFSS	0x11, 5			; PIR1.RCIF
+//	BRA		SinDato
+//	MOVLB	3
+//	MOVF	0x19, W			; RCREG (0x199)
+//	MOVLB	0
+//	MOVWF	INDF1
+//	INCF	0x70, F
+//	BCF		0x70, 4			; de 16 vuelve a 0
+//	BRA		FinHueco		; con dato: 4 + 2 + 6 + 2 = 14 ciclos
+//SinDato:
+//	NOP						; 7 NOP: sin dato 4 + 3 + 7 = 14 ciclos
+//	...
+//FinHueco:
+// ---------------------------------------------------------------
+// Fosc = 48000000 Hz, Tcy = 83.33 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        6    500.0      500 +-150         150.0
+// T1H       14   1166.7     1200 +-150         116.7
+// T0L       26   2166.7
+// T1L       18   1500.0
+// Periodo   32   2666.7     2500 +-600         433.3  (375 KHz)
+// Margen minimo: 116.7 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+#asm asis
+SendByte48_400:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 7		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+#ifdef PIX_HUECO
+	; ----- HUECO DEL PROGRAMA [15]-[31]: PIX_HUECO_CICLOS fijos + relleno -----
+#include PIX_HUECO
+#if PIX_HUECO_CICLOS < 17
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 16
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 15
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 14
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 13
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 12
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 11
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 10
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 9
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 8
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 7
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 6
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 5
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 4
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 3
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 2
+	NOP						; relleno
+#endif
+#if PIX_HUECO_CICLOS < 1
+	NOP						; relleno
+#endif
+#else
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+#endif
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 6		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 5		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 4		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 3		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 2		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 1		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 0		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	INCF	FSR0L, F		; [7] incrementar puntero
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	i, F			; [29] decrementar contador
+	GOTO	SendByte48_400	; [30] si no es cero, siguiente byte
+	; Fin de transmision
+#endasm
+
+#endif	//Fin de envio de datos a 48Mhz
+
+#elif getenv("CLOCK") == 24000000
+// ==================== ENVIO DE DATOS A 24MHZ (400KHZ) ====================
+//Tiempos de tools/pix_genbucle.c (forma A) escritos en C: el pin va por
+//PIX_ENV_PIN con #use fast_io, if(!bit_test()) + output_low() son BTFSS + BCF
+// ---------------------------------------------------------------
+// Fosc = 24000000 Hz, Tcy = 166.67 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        3    500.0      500 +-150         150.0
+// T1H        7   1166.7     1200 +-150         116.7
+// T0L       12   2000.0
+// T1L        8   1333.3
+// Periodo   15   2500.0     2500 +-600         600.0  (400 KHz)
+// Margen minimo: 116.7 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+
+SendByte24_400:				//Clk	Instr
+	//bit7 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 7))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(3);		//4-6	3
+	output_low(PIX_ENV_PIN);	//7		1
+	delay_cycles(7);		//8-14	7
+	
+	//bit6 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 6))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(3);		//4-6	3
+	output_low(PIX_ENV_PIN);	//7		1
+	delay_cycles(7);		//8-14	7
+	
+	//bit5 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 5))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(3);		//4-6	3
+	output_low(PIX_ENV_PIN);	//7		1
+	delay_cycles(7);		//8-14	7
+	
+	//bit4 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 4))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(3);		//4-6	3
+	output_low(PIX_ENV_PIN);	//7		1
+	delay_cycles(7);		//8-14	7
+	
+	//bit3 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 3))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(3);		//4-6	3
+	output_low(PIX_ENV_PIN);	//7		1
+	delay_cycles(7);		//8-14	7
+	
+	//bit2 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 2))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(3);		//4-6	3
+	output_low(PIX_ENV_PIN);	//7		1
+	delay_cycles(7);		//8-14	7
+	
+	//bit1 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 1))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(3);		//4-6	3
+	output_low(PIX_ENV_PIN);	//7		1
+	delay_cycles(7);		//8-14	7
+	
+	//bit0 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 0))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	FSR0L++;				//4		1	incrementar puntero
+	delay_cycles(2);		//5-6	2
+	output_low(PIX_ENV_PIN);	//7		1
+	delay_cycles(4);		//8-11	4
+#asm
+	DECFSZ	i, F			//12		1	decrementar contador de bytes enviados
+	GOTO	SendByte24_400		//13-14	2	siguiente byte. Con i = 0 salta el GOTO y termina
+#endasm
+	//Fin de transmision
+
+#elif getenv("CLOCK") == 16000000
+// ==================== ENVIO DE DATOS A 16MHZ (400KHZ) ====================
+//Tiempos de tools/pix_genbucle.c (forma A) escritos en C, como a 24MHz
+// ---------------------------------------------------------------
+// Fosc = 16000000 Hz, Tcy = 250.00 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        2    500.0      500 +-150         150.0
+// T1H        5   1250.0     1200 +-150         100.0
+// T0L        8   2000.0
+// T1L        5   1250.0
+// Periodo   10   2500.0     2500 +-600         600.0  (400 KHz)
+// Margen minimo: 100.0 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+
+SendByte16_400:				//Clk	Instr
+	//bit7 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	if(!bit_test(INDF0, 7))	//1		1
+		output_low(PIX_ENV_PIN);//2		1
+	delay_cycles(2);		//3-4	2
+	output_low(PIX_ENV_PIN);	//5		1
+	delay_cycles(4);		//6-9	4
+	
+	//bit6 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	if(!bit_test(INDF0, 6))	//1		1
+		output_low(PIX_ENV_PIN);//2		1
+	delay_cycles(2);		//3-4	2
+	output_low(PIX_ENV_PIN);	//5		1
+	delay_cycles(4);		//6-9	4
+	
+	//bit5 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	if(!bit_test(INDF0, 5))	//1		1
+		output_low(PIX_ENV_PIN);//2		1
+	delay_cycles(2);		//3-4	2
+	output_low(PIX_ENV_PIN);	//5		1
+	delay_cycles(4);		//6-9	4
+	
+	//bit4 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	if(!bit_test(INDF0, 4))	//1		1
+		output_low(PIX_ENV_PIN);//2		1
+	delay_cycles(2);		//3-4	2
+	output_low(PIX_ENV_PIN);	//5		1
+	delay_cycles(4);		//6-9	4
+	
+	//bit3 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	if(!bit_test(INDF0, 3))	//1		1
+		output_low(PIX_ENV_PIN);//2		1
+	delay_cycles(2);		//3-4	2
+	output_low(PIX_ENV_PIN);	//5		1
+	delay_cycles(4);		//6-9	4
+	
+	//bit2 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	if(!bit_test(INDF0, 2))	//1		1
+		output_low(PIX_ENV_PIN);//2		1
+	delay_cycles(2);		//3-4	2
+	output_low(PIX_ENV_PIN);	//5		1
+	delay_cycles(4);		//6-9	4
+	
+	//bit1 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	if(!bit_test(INDF0, 1))	//1		1
+		output_low(PIX_ENV_PIN);//2		1
+	delay_cycles(2);		//3-4	2
+	output_low(PIX_ENV_PIN);	//5		1
+	delay_cycles(4);		//6-9	4
+	
+	//bit0 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	if(!bit_test(INDF0, 0))	//1		1
+		output_low(PIX_ENV_PIN);//2		1
+	FSR0L++;				//3		1	incrementar puntero
+	delay_cycles(1);		//4		1
+	output_low(PIX_ENV_PIN);	//5		1
+	delay_cycles(1);		//6		1
+#asm
+	DECFSZ	i, F			//7		1	decrementar contador de bytes enviados
+	GOTO	SendByte16_400		//8-9	2	siguiente byte. Con i = 0 salta el GOTO y termina
+#endasm
+	//Fin de transmision
+
+#elif defined(PIX_ENV_800)
+// ==================== ENVIO DE DATOS A 32MHZ (800KHZ) ====================
+//Tiempos de tools/pix_genbucle.c (forma A) escritos en C, como a 24MHz
+// ---------------------------------------------------------------
+// Fosc = 32000000 Hz, Tcy = 125.00 ns, chip ws2812
+//         ciclos     ns     spec (ns)         margen
+// T0H        3    375.0      400 +-150         125.0
+// T1H        6    750.0      800 +-150         100.0
+// T0L        7    875.0
+// T1L        4    500.0
+// Periodo   10   1250.0     1250 +-600         600.0  (800 KHz)
+// Margen minimo: 100.0 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+
+SendByte32_800:				//Clk	Instr
+	//bit7 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 7))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(2);		//4-5	2
+	output_low(PIX_ENV_PIN);	//6		1
+	delay_cycles(3);		//7-9	3
+	
+	//bit6 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 6))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(2);		//4-5	2
+	output_low(PIX_ENV_PIN);	//6		1
+	delay_cycles(3);		//7-9	3
+	
+	//bit5 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 5))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(2);		//4-5	2
+	output_low(PIX_ENV_PIN);	//6		1
+	delay_cycles(3);		//7-9	3
+	
+	//bit4 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 4))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(2);		//4-5	2
+	output_low(PIX_ENV_PIN);	//6		1
+	delay_cycles(3);		//7-9	3
+	
+	//bit3 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 3))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(2);		//4-5	2
+	output_low(PIX_ENV_PIN);	//6		1
+	delay_cycles(3);		//7-9	3
+	
+	//bit2 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 2))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(2);		//4-5	2
+	output_low(PIX_ENV_PIN);	//6		1
+	delay_cycles(3);		//7-9	3
+	
+	//bit1 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 1))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	delay_cycles(2);		//4-5	2
+	output_low(PIX_ENV_PIN);	//6		1
+	delay_cycles(3);		//7-9	3
+	
+	//bit0 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(1);		//1		1
+	if(!bit_test(INDF0, 0))	//2		1
+		output_low(PIX_ENV_PIN);//3		1
+	FSR0L++;				//4		1	incrementar puntero
+	delay_cycles(1);		//5		1
+	output_low(PIX_ENV_PIN);	//6		1
+#asm
+	DECFSZ	i, F			//7		1	decrementar contador de bytes enviados
+	GOTO	SendByte32_800		//8-9	2	siguiente byte. Con i = 0 salta el GOTO y termina
+#endasm
+	//Fin de transmision
+
+#else
+// ==================== ENVIO DE DATOS A 32MHZ (400KHZ) ====================
+//Tiempos de tools/pix_genbucle.c (forma A) escritos en C, como a 24MHz
+// ---------------------------------------------------------------
+// Fosc = 32000000 Hz, Tcy = 125.00 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        4    500.0      500 +-150         150.0
+// T1H       10   1250.0     1200 +-150         100.0
+// T0L       16   2000.0
+// T1L       10   1250.0
+// Periodo   20   2500.0     2500 +-600         600.0  (400 KHz)
+// Margen minimo: 100.0 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+
+SendByte32_400:				//Clk	Instr
+	//bit7 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(2);		//1-2	2
+	if(!bit_test(INDF0, 7))	//3		1
+		output_low(PIX_ENV_PIN);//4		1
+	delay_cycles(5);		//5-9	5
+	output_low(PIX_ENV_PIN);	//10		1
+	delay_cycles(9);		//11-19	9
+	
+	//bit6 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(2);		//1-2	2
+	if(!bit_test(INDF0, 6))	//3		1
+		output_low(PIX_ENV_PIN);//4		1
+	delay_cycles(5);		//5-9	5
+	output_low(PIX_ENV_PIN);	//10		1
+	delay_cycles(9);		//11-19	9
+	
+	//bit5 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(2);		//1-2	2
+	if(!bit_test(INDF0, 5))	//3		1
+		output_low(PIX_ENV_PIN);//4		1
+	delay_cycles(5);		//5-9	5
+	output_low(PIX_ENV_PIN);	//10		1
+	delay_cycles(9);		//11-19	9
+	
+	//bit4 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(2);		//1-2	2
+	if(!bit_test(INDF0, 4))	//3		1
+		output_low(PIX_ENV_PIN);//4		1
+	delay_cycles(5);		//5-9	5
+	output_low(PIX_ENV_PIN);	//10		1
+	delay_cycles(9);		//11-19	9
+	
+	//bit3 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(2);		//1-2	2
+	if(!bit_test(INDF0, 3))	//3		1
+		output_low(PIX_ENV_PIN);//4		1
+	delay_cycles(5);		//5-9	5
+	output_low(PIX_ENV_PIN);	//10		1
+	delay_cycles(9);		//11-19	9
+	
+	//bit2 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(2);		//1-2	2
+	if(!bit_test(INDF0, 2))	//3		1
+		output_low(PIX_ENV_PIN);//4		1
+	delay_cycles(5);		//5-9	5
+	output_low(PIX_ENV_PIN);	//10		1
+	delay_cycles(9);		//11-19	9
+	
+	//bit1 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(2);		//1-2	2
+	if(!bit_test(INDF0, 1))	//3		1
+		output_low(PIX_ENV_PIN);//4		1
+	delay_cycles(5);		//5-9	5
+	output_low(PIX_ENV_PIN);	//10		1
+	delay_cycles(9);		//11-19	9
+	
+	//bit0 ---
+	output_high(PIX_ENV_PIN);	//0		1
+	delay_cycles(2);		//1-2	2
+	if(!bit_test(INDF0, 0))	//3		1
+		output_low(PIX_ENV_PIN);//4		1
+	FSR0L++;				//5		1	incrementar puntero
+	delay_cycles(4);		//6-9	4
+	output_low(PIX_ENV_PIN);	//10		1
+	delay_cycles(6);		//11-16	6
+#asm
+	DECFSZ	i, F			//17		1	decrementar contador de bytes enviados
+	GOTO	SendByte32_400		//18-19	2	siguiente byte. Con i = 0 salta el GOTO y termina
+#endasm
+	//Fin de transmision
+
+#endif	//Fin de envio de datos
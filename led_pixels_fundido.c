@@ -0,0 +1,108 @@
+#include <led_pixels_fundido.h>
+
+/*
+ * Lee el byte (i) del fotograma destino, este en RAM o en ROM
+ */
+#inline
+int FundidoDestino(long i){
+	if(FundidoEnROM)
+		return FundidoROM[i];
+	else
+		return FundidoRAM[i];
+}
+
+/*
+ * Calcula el incremento por paso de cada byte: |destino - actual| / Pasos en
+ * formato 8.8. La division se hace con la tabla de inversos (65536/Pasos),
+ * una multiplicacion por byte y solo al iniciar el fundido
+ */
+void FundidoPreparar(int Pasos){
+long i;
+int32 Prod;
+int d, v;
+	
+	FundidoPasos = Pasos;
+	if(Pasos < 2) return;	//con 1 paso se copia el destino directamente
+	
+	for(i = 0; i < PIX_NUM_BYTES; i++){
+		d = FundidoDestino(i);
+		v = Pixels[i];
+		
+		if(d > v) d = d - v;
+		else d = v - d;
+		
+		//d * (65536/Pasos) >> 8 = incremento 8.8
+		Prod = _mul(PixInverso[Pasos], d);
+		FundidoEnt[i] = make8(Prod, 2);
+		FundidoFrac[i] = make8(Prod, 1);
+		FundidoAcc[i] = 0x80;	//empieza a mitad para repartir el redondeo
+	}
+}
+
+/*
+ * Prepara un fundido desde Pixels[] hasta el fotograma Destino (en RAM)
+ * Parámetros: Destino = PIX_NUM_BYTES bytes en formato de Pixels[],
+ * Pasos = numero de llamadas a PasoFundido() hasta llegar (1-255)
+ */
+void IniciarFundido(int *Destino, int Pasos){
+	FundidoRAM = Destino;
+	FundidoEnROM = FALSE;
+	FundidoPreparar(Pasos);
+}
+
+/*
+ * Igual que IniciarFundido() pero con el fotograma en memoria de programa
+ */
+void IniciarFundidoROM(rom int *Destino, int Pasos){
+	FundidoROM = Destino;
+	FundidoEnROM = TRUE;
+	FundidoPreparar(Pasos);
+}
+
+/*
+ * Avanza un paso del fundido y deja el resultado en Pixels[]
+ * Devuelve TRUE si ha dado un paso (hay que mostrarlo), FALSE si el fundido
+ * ya habia terminado
+ * Solo sumas y comparaciones por byte; los bytes que ya estan en su destino
+ * se saltan
+ */
+short PasoFundido(void){
+long i;
+int d, v, Paso, Acc;
+	
+	if(FundidoPasos == 0) return FALSE;
+	
+	if(FundidoPasos == 1){
+		//ultimo paso: se copia el destino exacto, sin errores de redondeo
+		for(i = 0; i < PIX_NUM_BYTES; i++){
+			Pixels[i] = FundidoDestino(i);
+		}
+	}else{
+		for(i = 0; i < PIX_NUM_BYTES; i++){
+			d = FundidoDestino(i);
+			v = Pixels[i];
+			if(v == d) continue;	//este byte ya ha llegado
+			
+			//Bresenham: la fraccion se acumula y su acarreo suma 1 al paso
+			Paso = FundidoEnt[i];
+			Acc = FundidoAcc[i] + FundidoFrac[i];
+			if(Acc < FundidoFrac[i]) Paso++;
+			FundidoAcc[i] = Acc;
+			
+			//se avanza hacia el destino sin pasarse
+			if(v < d){
+				if((d - v) <= Paso) v = d;
+				else v += Paso;
+			}else{
+				if((v - d) <= Paso) v = d;
+				else v -= Paso;
+			}
+			Pixels[i] = v;
+		}
+	}
+	
+	PIX_BUFFER_TOCADO();
+	
+	FundidoPasos--;
+	return TRUE;
+}
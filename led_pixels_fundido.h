@@ -0,0 +1,71 @@
+/* 
+ * File:   led_pixels_fundido.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Fundido (cross-fade) entre el contenido actual de Pixels[] y otro fotograma
+ * en un numero fijo de pasos. Cada llamada a PasoFundido() avanza un paso.
+ * 
+ * Al empezar se calcula para cada byte cuanto tiene que avanzar por paso, en
+ * formato 8.8, usando la tabla de inversos de CambiarBrillo() (sin dividir).
+ * En cada paso solo se suma el incremento y el acarreo de la parte fraccionaria
+ * (estilo Bresenham), sin multiplicaciones ni divisiones por pixel. Los bytes
+ * que ya han llegado a su destino no se tocan, asi que el coste de cada paso
+ * es proporcional a los bytes que todavia cambian.
+ * 
+ * El fotograma destino esta en el mismo formato que Pixels[] (3 bytes por LED
+ * en orden GRB, o RGB con PIX_RGB) y se copia tal cual: no se le aplica Brillo.
+ * Puede estar en RAM o en memoria de programa.
+ * 
+ * RAM: necesita 3 bytes extra por cada byte del buffer (9 por LED)
+ * ----------------------------------------------------------------------------
+ * 
+ * Uso:
+ * #include "led_pixels.c"
+ * #include "led_pixels_fundido.c"
+ * 
+ * IniciarFundido(OtroBuffer, 50);		//50 pasos
+ * while(PasoFundido()){
+ * 	MostrarPixels();
+ * 	delay_ms(20);
+ * }
+ * ---------------------------------------------------------------------------*/
+
+/* --------------------------------- FUNCIONES --------------------------------
+ * 
+ * -IniciarFundido(int *Destino, int Pasos)
+ * Prepara un fundido desde Pixels[] hasta el fotograma Destino (RAM)
+ * 
+ * -IniciarFundidoROM(rom int *Destino, int Pasos)
+ * Igual que la anterior con el fotograma en memoria de programa
+ * 
+ * -PasoFundido()
+ * Avanza un paso. Devuelve TRUE si ha dado un paso y FALSE cuando el fundido
+ * ya habia terminado (Pixels[] es igual al destino). No llama a MostrarPixels()
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_FUNDIDO_H
+#define	LED_PIXELS_FUNDIDO_H
+
+#if (PIX_NUM_BYTES * 4) > getenv("RAM")
+	#error "No hay suficiente RAM para el fundido (9 bytes extra por LED)"
+#endif
+
+/* VARIABLES */
+int FundidoEnt[PIX_NUM_BYTES];		//parte entera del incremento por paso
+int FundidoFrac[PIX_NUM_BYTES];		//parte fraccionaria del incremento por paso
+int FundidoAcc[PIX_NUM_BYTES];		//acumulador de la parte fraccionaria
+int *FundidoRAM;					//fotograma destino en RAM
+rom int *FundidoROM;				//fotograma destino en ROM
+short FundidoEnROM = FALSE;			//TRUE: el destino esta en ROM
+int FundidoPasos = 0;				//pasos que quedan, 0 = sin fundido
+
+/* PROTOTIPOS */
+void IniciarFundido(int *Destino, int Pasos);
+void IniciarFundidoROM(rom int *Destino, int Pasos);
+short PasoFundido(void);
+
+#endif	/* LED_PIXELS_FUNDIDO_H */
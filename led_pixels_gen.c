@@ -0,0 +1,1166 @@
+/* 
+ * File:   led_pixels_gen.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Bucles de envio para 20MHz, 40MHz y 64MHz generados con tools/pix_genbucle.c
+ * NO EDITAR A MANO: para cambiar tiempos o añadir otra frecuencia, volver a
+ * generarlos, por ejemplo:
+ * pix_genbucle -f 40000000 -c ws2812 -n 40_800
+ * 
+ * Se incluye desde led_pixels_envio.c, con FSR0 apuntando al buffer, i = numero
+ * de bytes y las interrupciones desactivadas. Usa PIX_ENV_PORT / PIX_ENV_BIT
+ * y PIX_ENV_800 igual que los bucles de 48MHz.
+ * 
+ * 800KHz usa los tiempos del WS2812 y 400KHz los del WS2811. A 20MHz el modo
+ * 800KHz queda en 625KHz: el periodo sigue dentro de la tolerancia del WS2812
+ * y T0H/T1H quedan centrados.
+ * ---------------------------------------------------------------------------*/
+
+#if getenv("CLOCK") == 20000000
+// ==================== ENVIO DE DATOS A 20MHZ ====================
+
+#ifdef PIX_ENV_800
+// ---------------------------------------------------------------
+// Fosc = 20000000 Hz, Tcy = 200.00 ns, chip ws2812
+//         ciclos     ns     spec (ns)         margen
+// T0H        2    400.0      400 +-150         150.0
+// T1H        4    800.0      800 +-150         150.0
+// T0L        6   1200.0
+// T1L        4    800.0
+// Periodo    8   1600.0     1250 +-600         250.0  (625 KHz)
+// Margen minimo: 150.0 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+#asm asis
+SendByte20_800:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 7		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 6		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 5		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 4		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 3		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 2		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 1		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 0		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	INCF	FSR0L, F		; [3] incrementar puntero
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	i, F			; [5] decrementar contador
+	GOTO	SendByte20_800	; [6] si no es cero, siguiente byte
+	; Fin de transmision
+#endasm
+
+#else
+// ---------------------------------------------------------------
+// Fosc = 20000000 Hz, Tcy = 200.00 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        2    400.0      500 +-150          50.0
+// T1H        6   1200.0     1200 +-150         150.0
+// T0L       10   2000.0
+// T1L        6   1200.0
+// Periodo   12   2400.0     2500 +-600         500.0  (417 KHz)
+// Margen minimo: 50.0 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+#asm asis
+SendByte20_400:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 7		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 6		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 5		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 4		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 3		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 2		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 1		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 0		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	INCF	FSR0L, F		; [3] incrementar puntero
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	i, F			; [9] decrementar contador
+	GOTO	SendByte20_400	; [10] si no es cero, siguiente byte
+	; Fin de transmision
+#endasm
+
+#endif
+
+#elif getenv("CLOCK") == 40000000
+// ==================== ENVIO DE DATOS A 40MHZ ====================
+
+#ifdef PIX_ENV_800
+// ---------------------------------------------------------------
+// Fosc = 40000000 Hz, Tcy = 100.00 ns, chip ws2812
+//         ciclos     ns     spec (ns)         margen
+// T0H        4    400.0      400 +-150         150.0
+// T1H        8    800.0      800 +-150         150.0
+// T0L        8    800.0
+// T1L        4    400.0
+// Periodo   12   1200.0     1250 +-600         550.0  (833 KHz)
+// Margen minimo: 150.0 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+#asm asis
+SendByte40_800:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 7		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 6		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 5		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 4		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 3		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 2		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 1		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 0		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	INCF	FSR0L, F		; [5] incrementar puntero
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	i, F			; [9] decrementar contador
+	GOTO	SendByte40_800	; [10] si no es cero, siguiente byte
+	; Fin de transmision
+#endasm
+
+#else
+// ---------------------------------------------------------------
+// Fosc = 40000000 Hz, Tcy = 100.00 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        5    500.0      500 +-150         150.0
+// T1H       12   1200.0     1200 +-150         150.0
+// T0L       20   2000.0
+// T1L       13   1300.0
+// Periodo   25   2500.0     2500 +-600         600.0  (400 KHz)
+// Margen minimo: 150.0 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+#asm asis
+SendByte40_400:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 7		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 6		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 5		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 4		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 3		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 2		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 1		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 0		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	INCF	FSR0L, F		; [6] incrementar puntero
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	i, F			; [22] decrementar contador
+	GOTO	SendByte40_400	; [23] si no es cero, siguiente byte
+	; Fin de transmision
+#endasm
+
+#endif
+
+#elif getenv("CLOCK") == 64000000
+// ==================== ENVIO DE DATOS A 64MHZ ====================
+
+#ifdef PIX_ENV_800
+// ---------------------------------------------------------------
+// Fosc = 64000000 Hz, Tcy = 62.50 ns, chip ws2812
+//         ciclos     ns     spec (ns)         margen
+// T0H        6    375.0      400 +-150         125.0
+// T1H       13    812.5      800 +-150         137.5
+// T0L       14    875.0
+// T1L        7    437.5
+// Periodo   20   1250.0     1250 +-600         600.0  (800 KHz)
+// Margen minimo: 125.0 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+#asm asis
+SendByte64_800:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 7		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 6		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 5		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 4		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 3		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 2		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 1		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 0		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	INCF	FSR0L, F		; [7] incrementar puntero
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	i, F			; [17] decrementar contador
+	GOTO	SendByte64_800	; [18] si no es cero, siguiente byte
+	; Fin de transmision
+#endasm
+
+#else
+// ---------------------------------------------------------------
+// Fosc = 64000000 Hz, Tcy = 62.50 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        8    500.0      500 +-150         150.0
+// T1H       19   1187.5     1200 +-150         137.5
+// T0L       32   2000.0
+// T1L       21   1312.5
+// Periodo   40   2500.0     2500 +-600         600.0  (400 KHz)
+// Margen minimo: 137.5 ns
+// Control de bucle: forma A
+// ---------------------------------------------------------------
+#asm asis
+SendByte64_400:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 7		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 6		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 5		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 4		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 3		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 2		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 1		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 0		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	INCF	FSR0L, F		; [9] incrementar puntero
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	i, F			; [37] decrementar contador
+	GOTO	SendByte64_400	; [38] si no es cero, siguiente byte
+	; Fin de transmision
+#endasm
+
+#endif
+
+#endif	//Fin de bucles generados
@@ -0,0 +1,2199 @@
+/* 
+ * File:   led_pixels_gen18.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Bucles de envio para PIC18 generados con tools/pix_genbucle.c (opcion -18)
+ * NO EDITAR A MANO: para cambiar tiempos o añadir otra frecuencia, volver a
+ * generarlos, por ejemplo:
+ * pix_genbucle -18 -f 64000000 -c ws2812 -n 18_64_800
+ * 
+ * Se incluye desde led_pixels_envio.c, con FSR0 apuntando al buffer, el numero
+ * de bytes en PRODH:PRODL y las interrupciones desactivadas. PIX_ENV_PORT
+ * (PIX_ASM_PORT) tiene que ser la direccion del registro LAT del pin.
+ * 
+ * MOVF POSTINC0 avanza los 12 bits de FSR0, asi que el buffer puede ocupar
+ * varios bancos de RAM. El contador es de 16 bits: cada 256 bytes el nivel
+ * bajo del ultimo bit dura 2 ciclos mas, sin efecto en los LEDs.
+ * 
+ * 800KHz usa los tiempos del WS2812 y 400KHz los del WS2811. A 16MHz y 24MHz
+ * solo hay 400KHz, igual que en PIC16. A 20MHz el modo 800KHz queda en 625KHz.
+ * ---------------------------------------------------------------------------*/
+
+#if getenv("CLOCK") == 16000000
+// ==================== ENVIO DE DATOS A 16MHZ ====================
+
+// ---------------------------------------------------------------
+// Fosc = 16000000 Hz, Tcy = 250.00 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        2    500.0      500 +-150         150.0
+// T1H        5   1250.0     1200 +-150         100.0
+// T0L        8   2000.0
+// T1L        5   1250.0
+// Periodo   10   2500.0     2500 +-600         600.0  (400 KHz)
+// Margen minimo: 100.0 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_16_400:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 7		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 6		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 5		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 4		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 3		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 2		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 1		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 0		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [3] incrementar puntero (16 bits)
+	NOP						; [4] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0
+	NOP						; [6] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [7] decrementar contador (parte baja)
+	BRA		SendByte18_16_400	; [8] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [9] cada 256 bytes: parte alta
+	BRA		SendByte18_16_400	; [10] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#elif getenv("CLOCK") == 20000000
+// ==================== ENVIO DE DATOS A 20MHZ ====================
+
+#ifdef PIX_ENV_800
+// ---------------------------------------------------------------
+// Fosc = 20000000 Hz, Tcy = 200.00 ns, chip ws2812
+//         ciclos     ns     spec (ns)         margen
+// T0H        2    400.0      400 +-150         150.0
+// T1H        4    800.0      800 +-150         150.0
+// T0L        6   1200.0
+// T1L        4    800.0
+// Periodo    8   1600.0     1250 +-600         250.0  (625 KHz)
+// Margen minimo: 150.0 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_20_800:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 7		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 6		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 5		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 4		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 3		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 2		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 1		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 0		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [3] incrementar puntero (16 bits)
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [5] decrementar contador (parte baja)
+	BRA		SendByte18_20_800	; [6] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [7] cada 256 bytes: parte alta
+	BRA		SendByte18_20_800	; [8] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#else
+// ---------------------------------------------------------------
+// Fosc = 20000000 Hz, Tcy = 200.00 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        2    400.0      500 +-150          50.0
+// T1H        6   1200.0     1200 +-150         150.0
+// T0L       10   2000.0
+// T1L        6   1200.0
+// Periodo   12   2400.0     2500 +-600         500.0  (417 KHz)
+// Margen minimo: 50.0 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_20_400:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 7		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 6		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 5		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 4		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 3		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 2		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 1		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	BTFSS	INDF0, 0		; [1] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [2] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [3] incrementar puntero (16 bits)
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [9] decrementar contador (parte baja)
+	BRA		SendByte18_20_400	; [10] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [11] cada 256 bytes: parte alta
+	BRA		SendByte18_20_400	; [12] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#endif
+
+#elif getenv("CLOCK") == 24000000
+// ==================== ENVIO DE DATOS A 24MHZ ====================
+
+// ---------------------------------------------------------------
+// Fosc = 24000000 Hz, Tcy = 166.67 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        3    500.0      500 +-150         150.0
+// T1H        7   1166.7     1200 +-150         116.7
+// T0L       12   2000.0
+// T1L        8   1333.3
+// Periodo   15   2500.0     2500 +-600         600.0  (400 KHz)
+// Margen minimo: 116.7 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_24_400:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 7		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [7] PIX = 0
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 6		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [7] PIX = 0
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 5		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [7] PIX = 0
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 4		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [7] PIX = 0
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 3		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [7] PIX = 0
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 2		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [7] PIX = 0
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 1		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [7] PIX = 0
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 0		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [4] incrementar puntero (16 bits)
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [7] PIX = 0
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [12] decrementar contador (parte baja)
+	BRA		SendByte18_24_400	; [13] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [14] cada 256 bytes: parte alta
+	BRA		SendByte18_24_400	; [15] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#elif getenv("CLOCK") == 32000000
+// ==================== ENVIO DE DATOS A 32MHZ ====================
+
+#ifdef PIX_ENV_800
+// ---------------------------------------------------------------
+// Fosc = 32000000 Hz, Tcy = 125.00 ns, chip ws2812
+//         ciclos     ns     spec (ns)         margen
+// T0H        3    375.0      400 +-150         125.0
+// T1H        6    750.0      800 +-150         100.0
+// T0L        7    875.0
+// T1L        4    500.0
+// Periodo   10   1250.0     1250 +-600         600.0  (800 KHz)
+// Margen minimo: 100.0 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_32_800:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 7		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 6		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 5		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 4		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 3		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 2		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 1		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	NOP						; [4] delay
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	BTFSS	INDF0, 0		; [2] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [3] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [4] incrementar puntero (16 bits)
+	NOP						; [5] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [7] decrementar contador (parte baja)
+	BRA		SendByte18_32_800	; [8] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [9] cada 256 bytes: parte alta
+	BRA		SendByte18_32_800	; [10] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#else
+// ---------------------------------------------------------------
+// Fosc = 32000000 Hz, Tcy = 125.00 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        4    500.0      500 +-150         150.0
+// T1H       10   1250.0     1200 +-150         100.0
+// T0L       16   2000.0
+// T1L       10   1250.0
+// Periodo   20   2500.0     2500 +-600         600.0  (400 KHz)
+// Margen minimo: 100.0 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_32_400:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 7		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 6		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 5		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 4		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 3		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 2		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 1		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 0		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [5] incrementar puntero (16 bits)
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [17] decrementar contador (parte baja)
+	BRA		SendByte18_32_400	; [18] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [19] cada 256 bytes: parte alta
+	BRA		SendByte18_32_400	; [20] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#endif
+
+#elif getenv("CLOCK") == 40000000
+// ==================== ENVIO DE DATOS A 40MHZ ====================
+
+#ifdef PIX_ENV_800
+// ---------------------------------------------------------------
+// Fosc = 40000000 Hz, Tcy = 100.00 ns, chip ws2812
+//         ciclos     ns     spec (ns)         margen
+// T0H        4    400.0      400 +-150         150.0
+// T1H        8    800.0      800 +-150         150.0
+// T0L        8    800.0
+// T1L        4    400.0
+// Periodo   12   1200.0     1250 +-600         550.0  (833 KHz)
+// Margen minimo: 150.0 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_40_800:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 7		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 6		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 5		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 4		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 3		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 2		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 1		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	NOP						; [5] delay
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	BTFSS	INDF0, 0		; [3] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [4] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [5] incrementar puntero (16 bits)
+	NOP						; [6] delay
+	NOP						; [7] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [9] decrementar contador (parte baja)
+	BRA		SendByte18_40_800	; [10] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [11] cada 256 bytes: parte alta
+	BRA		SendByte18_40_800	; [12] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#else
+// ---------------------------------------------------------------
+// Fosc = 40000000 Hz, Tcy = 100.00 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        5    500.0      500 +-150         150.0
+// T1H       12   1200.0     1200 +-150         150.0
+// T0L       20   2000.0
+// T1L       13   1300.0
+// Periodo   25   2500.0     2500 +-600         600.0  (400 KHz)
+// Margen minimo: 150.0 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_40_400:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 7		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 6		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 5		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 4		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 3		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 2		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 1		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 0		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [6] incrementar puntero (16 bits)
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [12] PIX = 0
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [22] decrementar contador (parte baja)
+	BRA		SendByte18_40_400	; [23] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [24] cada 256 bytes: parte alta
+	BRA		SendByte18_40_400	; [25] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#endif
+
+#elif getenv("CLOCK") == 48000000
+// ==================== ENVIO DE DATOS A 48MHZ ====================
+
+#ifdef PIX_ENV_800
+// ---------------------------------------------------------------
+// Fosc = 48000000 Hz, Tcy = 83.33 ns, chip ws2812
+//         ciclos     ns     spec (ns)         margen
+// T0H        5    416.7      400 +-150         133.3
+// T1H       10    833.3      800 +-150         116.7
+// T0L       10    833.3
+// T1L        5    416.7
+// Periodo   15   1250.0     1250 +-600         600.0  (800 KHz)
+// Margen minimo: 116.7 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_48_800:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 7		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 6		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 5		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 4		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 3		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 2		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 1		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	NOP						; [6] delay
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	BTFSS	INDF0, 0		; [4] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [5] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [6] incrementar puntero (16 bits)
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [10] PIX = 0
+	NOP						; [11] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [12] decrementar contador (parte baja)
+	BRA		SendByte18_48_800	; [13] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [14] cada 256 bytes: parte alta
+	BRA		SendByte18_48_800	; [15] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#else
+// ---------------------------------------------------------------
+// Fosc = 48000000 Hz, Tcy = 83.33 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        6    500.0      500 +-150         150.0
+// T1H       14   1166.7     1200 +-150         116.7
+// T0L       24   2000.0
+// T1L       16   1333.3
+// Periodo   30   2500.0     2500 +-600         600.0  (400 KHz)
+// Margen minimo: 116.7 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_48_400:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 7		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 6		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 5		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 4		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 3		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 2		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 1		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 0		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [7] incrementar puntero (16 bits)
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [14] PIX = 0
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [27] decrementar contador (parte baja)
+	BRA		SendByte18_48_400	; [28] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [29] cada 256 bytes: parte alta
+	BRA		SendByte18_48_400	; [30] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#endif
+
+#elif getenv("CLOCK") == 64000000
+// ==================== ENVIO DE DATOS A 64MHZ ====================
+
+#ifdef PIX_ENV_800
+// ---------------------------------------------------------------
+// Fosc = 64000000 Hz, Tcy = 62.50 ns, chip ws2812
+//         ciclos     ns     spec (ns)         margen
+// T0H        6    375.0      400 +-150         125.0
+// T1H       13    812.5      800 +-150         137.5
+// T0L       14    875.0
+// T1L        7    437.5
+// Periodo   20   1250.0     1250 +-600         600.0  (800 KHz)
+// Margen minimo: 125.0 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_64_800:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 7		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 6		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 5		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 4		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 3		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 2		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 1		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	NOP						; [7] delay
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	NOP						; [19] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	BTFSS	INDF0, 0		; [5] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [6] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [7] incrementar puntero (16 bits)
+	NOP						; [8] delay
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [13] PIX = 0
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [17] decrementar contador (parte baja)
+	BRA		SendByte18_64_800	; [18] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [19] cada 256 bytes: parte alta
+	BRA		SendByte18_64_800	; [20] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#else
+// ---------------------------------------------------------------
+// Fosc = 64000000 Hz, Tcy = 62.50 ns, chip ws2811
+//         ciclos     ns     spec (ns)         margen
+// T0H        8    500.0      500 +-150         150.0
+// T1H       19   1187.5     1200 +-150         137.5
+// T0L       32   2000.0
+// T1L       21   1312.5
+// Periodo   40   2500.0     2500 +-600         600.0  (400 KHz)
+// Margen minimo: 137.5 ns
+// Control de bucle: forma A, PIC18 (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)
+// ---------------------------------------------------------------
+#asm asis
+SendByte18_64_400:
+	; ===== BIT 7 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 7		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 6 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 6		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 5 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 5		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 4 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 4		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 3 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 3		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 2 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 2		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 1 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 1		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	NOP						; [9] delay
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	NOP						; [37] delay
+	NOP						; [38] delay
+	NOP						; [39] delay
+	
+	; ===== BIT 0 =====
+	BSF		PIX_ENV_PORT, PIX_ENV_BIT	; [0] PIX = 1
+	NOP						; [1] delay
+	NOP						; [2] delay
+	NOP						; [3] delay
+	NOP						; [4] delay
+	NOP						; [5] delay
+	NOP						; [6] delay
+	BTFSS	INDF0, 0		; [7] bit a 1: salta el BCF
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [8] PIX = 0 si bit=0
+	MOVF	POSTINC0, W		; [9] incrementar puntero (16 bits)
+	NOP						; [10] delay
+	NOP						; [11] delay
+	NOP						; [12] delay
+	NOP						; [13] delay
+	NOP						; [14] delay
+	NOP						; [15] delay
+	NOP						; [16] delay
+	NOP						; [17] delay
+	NOP						; [18] delay
+	BCF		PIX_ENV_PORT, PIX_ENV_BIT	; [19] PIX = 0
+	NOP						; [20] delay
+	NOP						; [21] delay
+	NOP						; [22] delay
+	NOP						; [23] delay
+	NOP						; [24] delay
+	NOP						; [25] delay
+	NOP						; [26] delay
+	NOP						; [27] delay
+	NOP						; [28] delay
+	NOP						; [29] delay
+	NOP						; [30] delay
+	NOP						; [31] delay
+	NOP						; [32] delay
+	NOP						; [33] delay
+	NOP						; [34] delay
+	NOP						; [35] delay
+	NOP						; [36] delay
+	; ===== CONTROL DE LOOP =====
+	DECFSZ	PRODL, F		; [37] decrementar contador (parte baja)
+	BRA		SendByte18_64_400	; [38] si no es cero, siguiente byte
+	DECFSZ	PRODH, F		; [39] cada 256 bytes: parte alta
+	BRA		SendByte18_64_400	; [40] alarga 2 ciclos el nivel bajo
+	; Fin de transmision
+#endasm
+
+#endif
+
+#endif	//Fin de bucles generados PIC18
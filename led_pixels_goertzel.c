@@ -0,0 +1,104 @@
+/*
+ * File:   led_pixels_goertzel.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Nucleo de analisis del modulo de audio: volumen y energia de unas pocas
+ * bandas con filtros de Goertzel en aritmetica entera.
+ *
+ * Solo usa C estandar y los tipos PixU8, PixS8, PixS16, PixU32 y PixS32, que
+ * define quien lo incluye: led_pixels_audio.h en el PIC y tools/pix_audio.c
+ * en el PC, que lo compila tal cual para probarlo con archivos WAV.
+ *
+ * Cada banda es un resonador s = x + c*s1 - s2 con c = 2cos(w) en Q12. Con
+ * muestras de +-127, bloques de hasta 128 muestras y frecuencias entre
+ * 2/256 y 126/256 de la de muestreo, c*s1 no pasa de 2^30.
+ * La energia se devuelve en escala logaritmica: 8 unidades por cada vez que
+ * se dobla la potencia (unos 3dB), de 0 a 255.
+ * ---------------------------------------------------------------------------*/
+
+//cos(2*pi*i/256) en Q12, i = 0..64
+const PixS16 PixCosQ[65] = {
+	4096, 4095, 4091, 4085, 4076, 4065, 4052, 4036, 4017, 3996, 3973, 3948, 3920,
+	3889, 3857, 3822, 3784, 3745, 3703, 3659, 3612, 3564, 3513, 3461, 3406, 3349,
+	3290, 3229, 3166, 3102, 3035, 2967, 2896, 2824, 2751, 2675, 2598, 2520, 2440,
+	2359, 2276, 2191, 2106, 2019, 1931, 1842, 1751, 1660, 1567, 1474, 1380, 1285,
+	1189, 1092,  995,  897,  799,  700,  601,  501,  401,  301,  201,  101,    0
+
+};
+
+/*
+ * Coeficiente 2cos(2*pi*f/fs) en Q12. La frecuencia se redondea a 1/256 de
+ * la de muestreo y se limita al rango en el que no hay desbordamiento
+ */
+PixS16 PixAudioCoef(PixU32 f, PixU32 fs){
+PixU32 i;
+
+	i = (f * 256 + fs / 2) / fs;
+	if(i < 2) i = 2;
+	if(i > 126) i = 126;
+
+	if(i <= 64) return PixCosQ[i] * 2;
+	return -PixCosQ[128 - i] * 2;
+}
+
+/*
+ * 8 * log2(v): posicion del bit mas alto y los 3 bits siguientes
+ */
+PixU8 PixLog8(PixU32 v){
+PixU8 b;
+
+	if(v == 0) return 0;
+	b = 31;
+	while((v & 0x80000000) == 0){
+		v <<= 1;
+		b--;
+	}
+	return (b << 3) | (PixU8)((v >> 28) & 0x07);
+}
+
+/*
+ * Analiza un bloque de N muestras (N <= 128):
+ * - Volumen: desviacion media respecto a la media del bloque, 0-255
+ * - Niveles[b]: energia de la banda b (coeficiente Coef[b]) en escala log
+ */
+void PixAudioAnalizar(PixS8 *x, PixU8 N, PixS16 *Coef, PixU8 Bandas, PixU8 *Niveles, PixU8 *Volumen){
+PixS16 Suma, Media, v;
+PixS32 s0, s1, s2, a, b, P;
+PixU8 n, k;
+
+	//media del bloque (componente continua del microfono)
+	Suma = 0;
+	for(n = 0; n < N; n++) Suma += x[n];
+	Media = Suma / N;
+
+	Suma = 0;
+	for(n = 0; n < N; n++){
+		v = x[n] - Media;
+		Suma += (v < 0) ? -v : v;
+	}
+	v = (Suma * 2) / N;
+	*Volumen = (v > 255) ? 255 : (PixU8)v;
+
+	for(k = 0; k < Bandas; k++){
+		s1 = 0;
+		s2 = 0;
+		for(n = 0; n < N; n++){
+			v = x[n] - Media;
+			if(v > 127) v = 127;
+			if(v < -127) v = -127;
+			s0 = v + (((PixS32)Coef[k] * s1) >> 12) - s2;
+			s2 = s1;
+			s1 = s0;
+		}
+
+		//potencia = s1^2 + s2^2 - c*s1*s2, con s reducido para que quepa
+		a = s1 >> 4;
+		b = s2 >> 4;
+		P = a * a + b * b - ((((PixS32)Coef[k] * a) >> 12) * b);
+		Niveles[k] = (P > 0) ? PixLog8((PixU32)P) : 0;
+	}
+}
@@ -0,0 +1,142 @@
+#include <led_pixels_guion.h>
+
+#ifdef PIX_GUION_EEPROM
+void IniciarGuion(long Dir){
+	PixGuionDir = Dir;
+	PixGuionReiniciar();
+}
+#else
+void IniciarGuion(rom int *Guion){
+	PixGuion = Guion;
+	PixGuionReiniciar();
+}
+#endif
+
+/*
+ * Estado inicial: primera instruccion en el siguiente PasoGuion()
+ */
+void PixGuionReiniciar(void){
+	PixGuionPc = 0;
+	PixGuionEspera = 1;
+	PixGuionFase = 0;
+	PixGuionEfecto = PIX_EF_NADA;
+	PixGuionActivo = TRUE;
+}
+
+void PararGuion(void){
+	PixGuionActivo = FALSE;
+}
+
+/*
+ * Operando de 16 bits, primero el byte bajo
+ */
+long PixGuionLeer16(void){
+int l;
+	l = PIX_GUION_LEER();
+	return make16(PIX_GUION_LEER(), l);
+}
+
+/*
+ * LEDs Desde-Hasta con la rueda de color desde la fase actual, avanzando
+ * Paso por LED. La fase no cambia
+ */
+void PixGuionRueda(long Desde, long Hasta, int Paso){
+int f = PixGuionFase;
+
+	if(Hasta >= PIX_NUM_LEDS) Hasta = PIX_NUM_LEDS - 1;
+	for(; Desde <= Hasta; Desde++){
+		SetPixelColor((PixIndice)Desde, Wheel(f));
+		f += Paso;
+	}
+}
+
+/*
+ * Un fotograma: el efecto en marcha y las instrucciones hasta ESPERAR o FIN.
+ * Una operacion desconocida termina el guion igual que FIN
+ */
+short PasoGuion(void){
+int Op;
+int r, g;
+long Desde, Hasta;
+
+	if(PixGuionActivo == FALSE) return FALSE;
+
+	switch(PixGuionEfecto){
+		case PIX_EF_ESTELA:
+			FundirANegro(PixGuionA);
+			break;
+		case PIX_EF_ARCOIRIS:
+			PixGuionRueda(0, PIX_NUM_LEDS - 1, PixGuionA);
+			PixGuionFase += PixGuionB;
+			break;
+	}
+
+	if(--PixGuionEspera != 0) return TRUE;	//sigue esperando
+
+	while(TRUE){
+		Op = PIX_GUION_LEER();
+
+		switch(Op){
+			case PIX_OP_LLENAR:
+				Desde = PixGuionLeer16();
+				Hasta = PixGuionLeer16();
+				r = PIX_GUION_LEER();
+				g = PIX_GUION_LEER();
+				if(Hasta >= PIX_NUM_LEDS) Hasta = PIX_NUM_LEDS - 1;
+				if(Desde <= Hasta) LlenarDeColor((PixIndice)Desde, (PixIndice)Hasta, Color32(r, g, PIX_GUION_LEER()));
+				else PixGuionPc++;
+				break;
+
+			case PIX_OP_PIXEL:
+				Desde = PixGuionLeer16();
+				r = PIX_GUION_LEER();
+				g = PIX_GUION_LEER();
+				if(Desde < PIX_NUM_LEDS) SetPixelColor((PixIndice)Desde, r, g, PIX_GUION_LEER());
+				else PixGuionPc++;
+				break;
+
+			case PIX_OP_RUEDA:
+				Desde = PixGuionLeer16();
+				Hasta = PixGuionLeer16();
+				PixGuionRueda(Desde, Hasta, PIX_GUION_LEER());
+				break;
+
+			case PIX_OP_BRILLO:
+				CambiarBrillo(PIX_GUION_LEER());
+				break;
+
+			case PIX_OP_ESPERAR:
+				PixGuionEspera = PIX_GUION_LEER();
+				return TRUE;
+
+			case PIX_OP_FASE:
+				PixGuionFase += PIX_GUION_LEER();
+				break;
+
+			case PIX_OP_CONTAR:
+				r = PIX_GUION_LEER() & (PIX_GUION_CONTADORES - 1);
+				PixGuionCont[r] = PIX_GUION_LEER();
+				break;
+
+			case PIX_OP_BUCLE:
+				r = PIX_GUION_LEER() & (PIX_GUION_CONTADORES - 1);
+				Desde = PixGuionLeer16();
+				if(--PixGuionCont[r] != 0) PixGuionPc = Desde;
+				break;
+
+			case PIX_OP_SALTO:
+				PixGuionPc = PixGuionLeer16();
+				break;
+
+			case PIX_OP_EFECTO:
+				PixGuionEfecto = PIX_GUION_LEER();
+				PixGuionA = PIX_GUION_LEER();
+				PixGuionB = PIX_GUION_LEER();
+				break;
+
+			default:	//PIX_OP_FIN
+				PixGuionActivo = FALSE;
+				return TRUE;	//se envia lo que se ha dibujado hasta aqui
+		}
+	}
+}
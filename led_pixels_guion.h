@@ -0,0 +1,106 @@
+/*
+ * File:   led_pixels_guion.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Interprete de guiones de luces: el espectaculo es una lista de bytes en
+ * memoria de programa (o en la EEPROM) en lugar de una secuencia de llamadas
+ * a LlenarDeColor(), Wheel(), CambiarBrillo() y delay_ms() escrita a mano.
+ * Cambiar el espectaculo es cambiar el guion, no el programa.
+ *
+ * tools/pix_guion.c ensambla el guion desde texto y lo simula en el PC:
+ * escribe el array (o la linea #rom de la EEPROM) y el color de cada LED en
+ * cada fotograma. Los codigos de operacion estan en led_pixels_guion_op.h.
+ *
+ * Cada llamada a PasoGuion() es un fotograma: aplica el efecto en marcha y
+ * ejecuta instrucciones hasta la siguiente ESPERAR. El programa envia y marca
+ * el ritmo como siempre (delay, Timer, PIX_TARGET_FPS...).
+ *
+ * No hay pila ni llamadas: el estado es el contador de programa, 4 contadores
+ * de bucle, la fase de la rueda de color y el efecto en marcha. La operacion
+ * se despacha con un switch sobre codigos seguidos, que el compilador pasa a
+ * una tabla de saltos, y los operandos se leen de uno en uno, asi que el
+ * coste por instruccion son unas decenas de ciclos frente a los cientos o
+ * miles de la funcion de la libreria que llama (bench.c mide "Guion" por
+ * instruccion PIXEL para compararlo con SetPixelColor32).
+ *
+ * El PIC no comprueba bucles sin ESPERAR (PasoGuion() no volveria): el
+ * simulador si.
+ * ----------------------------------------------------------------------------
+ *
+ * Uso:
+ * #define PIX_GUION_EEPROM		//opcional: el guion esta en la EEPROM
+ * #include "led_pixels.c"
+ * #include "led_pixels_guion.c"
+ *
+ * //pix_guion -f show.txt -n Show
+ * rom int Show[] = {...};
+ *
+ * IniciarGuion(Show);			//con PIX_GUION_EEPROM: IniciarGuion(0)
+ * while(PasoGuion()){
+ * 	MostrarPixels();
+ * 	delay_ms(20);				//50 fotogramas por segundo
+ * }
+ * ---------------------------------------------------------------------------*/
+
+/* --------------------------------- FUNCIONES --------------------------------
+ *
+ * -IniciarGuion(rom int *Guion)
+ * -IniciarGuion(long Dir)			(con PIX_GUION_EEPROM)
+ * Empieza el guion desde el principio, sin efecto y con la fase a 0. No
+ * toca Pixels[] ni el brillo
+ *
+ * -PasoGuion()
+ * Avanza un fotograma. Devuelve FALSE cuando el guion ya ha terminado (el
+ * fotograma de la instruccion FIN todavia devuelve TRUE). No llama a
+ * MostrarPixels()
+ *
+ * -PararGuion()
+ * Termina el guion: las siguientes llamadas a PasoGuion() devuelven FALSE
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_GUION_H
+#define	LED_PIXELS_GUION_H
+
+#include "led_pixels_guion_op.h"
+
+#ifdef PIX_GUION_EEPROM
+	#if getenv("DATA_EEPROM") == 0
+		#error "Este PIC no tiene EEPROM para PIX_GUION_EEPROM"
+	#endif
+	//lectura del siguiente byte del guion
+	#define PIX_GUION_LEER()	read_eeprom(PixGuionDir + PixGuionPc++)
+#else
+	#define PIX_GUION_LEER()	PixGuion[PixGuionPc++]
+#endif
+
+/* VARIABLES */
+#ifdef PIX_GUION_EEPROM
+long PixGuionDir;				//direccion del guion en la EEPROM
+#else
+rom int *PixGuion;				//guion en memoria de programa
+#endif
+long PixGuionPc;				//siguiente byte a ejecutar
+int PixGuionEspera;				//fotogramas que faltan para seguir
+int PixGuionCont[PIX_GUION_CONTADORES];	//contadores de bucle
+int PixGuionFase;				//fase de la rueda de color
+int PixGuionEfecto;				//efecto en marcha (PIX_EF_x)
+int PixGuionA, PixGuionB;		//parametros del efecto
+short PixGuionActivo = FALSE;	//FALSE: no hay guion o ya ha terminado
+
+/* PROTOTIPOS */
+#ifdef PIX_GUION_EEPROM
+void IniciarGuion(long Dir);
+#else
+void IniciarGuion(rom int *Guion);
+#endif
+void PixGuionReiniciar(void);
+long PixGuionLeer16(void);
+void PixGuionRueda(long Desde, long Hasta, int Paso);
+short PasoGuion(void);
+void PararGuion(void);
+
+#endif	/* LED_PIXELS_GUION_H */
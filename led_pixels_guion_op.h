@@ -0,0 +1,43 @@
+/*
+ * File:   led_pixels_guion_op.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Codigos de operacion de los guiones de luces. Solo son #define, asi que lo
+ * incluyen tanto led_pixels_guion.h en el PIC como tools/pix_guion.c en el PC
+ * (ensamblador y simulador) y los dos leen el mismo formato.
+ *
+ * Cada instruccion es un byte de operacion seguido de sus operandos. Los LEDs
+ * y las direcciones van en 16 bits, primero el byte bajo. Los colores en 3
+ * bytes R, G, B.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_GUION_OP_H
+#define	LED_PIXELS_GUION_OP_H
+
+//Operaciones						operandos (bytes)
+#define PIX_OP_FIN			0x00	//-							fin del guion
+#define PIX_OP_LLENAR		0x01	//desde(2) hasta(2) r g b	LlenarDeColor()
+#define PIX_OP_PIXEL		0x02	//n(2) r g b				SetPixelColor()
+#define PIX_OP_RUEDA		0x03	//desde(2) hasta(2) paso	Wheel(Fase + paso * i)
+#define PIX_OP_BRILLO		0x04	//brillo					CambiarBrillo()
+#define PIX_OP_ESPERAR		0x05	//fotogramas (0 = 256)		termina el fotograma
+#define PIX_OP_FASE			0x06	//incremento				Fase += incremento
+#define PIX_OP_CONTAR		0x07	//contador(0-3) vueltas	contador = vueltas (0 = 256)
+#define PIX_OP_BUCLE		0x08	//contador dir(2)			si --contador != 0 salta
+#define PIX_OP_SALTO		0x09	//dir(2)					salta siempre
+#define PIX_OP_EFECTO		0x0A	//efecto a b				efecto en cada fotograma
+#define PIX_OP_NUM			0x0B
+
+//Efectos de PIX_OP_EFECTO, se aplican al empezar cada fotograma
+#define PIX_EF_NADA			0		//ninguno
+#define PIX_EF_ESTELA		1		//FundirANegro(a)
+#define PIX_EF_ARCOIRIS		2		//toda la tira con Wheel(Fase + a * i), Fase += b
+#define PIX_EF_NUM			3
+
+#define PIX_GUION_CONTADORES	4	//contadores de PIX_OP_CONTAR/PIX_OP_BUCLE
+
+#endif	/* LED_PIXELS_GUION_OP_H */
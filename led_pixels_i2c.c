@@ -0,0 +1,143 @@
+#include <led_pixels_i2c.h>
+
+#use i2c(SLAVE, I2C1, address=PIX_I2C_DIR, FORCE_HW)
+
+//Bytes de direccion de registro al empezar cada escritura
+#ifdef PIX_I2C_DIR16
+	#define PIX_I2C_BYTES_DIR		2
+#else
+	#define PIX_I2C_BYTES_DIR		1
+#endif
+
+/*
+ * Lee el registro (Reg)
+ */
+int PixI2CLeer(PixI2CDir Reg){
+	if(Reg >= PIX_I2C_PIXELS){
+		Reg -= PIX_I2C_PIXELS;
+		if(Reg < PIX_NUM_BYTES) return Pixels[Reg];
+		return 0;
+	}
+
+	switch(Reg){
+		case PIX_I2C_ESTADO:	return PixI2CPend;
+		case PIX_I2C_BRILLO:	return PixI2CBrillo;
+		case PIX_I2C_ROJO:		return PixI2CColor[0];
+		case PIX_I2C_VERDE:		return PixI2CColor[1];
+		case PIX_I2C_AZUL:		return PixI2CColor[2];
+		case PIX_I2C_LEDS_L:	return make8((long)PIX_NUM_LEDS, 0);
+		case PIX_I2C_LEDS_H:	return make8((long)PIX_NUM_LEDS, 1);
+	}
+	return 0;
+}
+
+/*
+ * Escribe (v) en el registro (Reg). Los bytes del buffer se guardan
+ * directamente; las ordenes solo se marcan para AtenderI2C()
+ */
+void PixI2CEscribir(PixI2CDir Reg, int v){
+	if(Reg >= PIX_I2C_PIXELS){
+		Reg -= PIX_I2C_PIXELS;
+		if(Reg < PIX_NUM_BYTES){
+			Pixels[Reg] = v;
+			PIX_BUFFER_TOCADO();
+		}
+		return;
+	}
+
+	switch(Reg){
+		case PIX_I2C_BRILLO:
+			PixI2CBrillo = v;
+			PixI2CPend |= PIX_I2C_PEND_BRILLO;
+			break;
+		case PIX_I2C_ROJO:		PixI2CColor[0] = v; break;
+		case PIX_I2C_VERDE:		PixI2CColor[1] = v; break;
+		case PIX_I2C_AZUL:		PixI2CColor[2] = v; break;
+		case PIX_I2C_RELLENAR:	PixI2CPend |= PIX_I2C_PEND_RELLENAR; break;
+		case PIX_I2C_MOSTRAR:	PixI2CPend |= PIX_I2C_PEND_MOSTRAR; break;
+	}
+}
+
+/*
+ * Interrupcion del MSSP: un byte por llamada
+ * La fase sale de SSPSTAT: R/W = 1 lectura, R/W = 0 escritura, y en cada una
+ * D/A = 0 es la direccion de esclavo y D/A = 1 un byte de datos. Asi no hay
+ * limite de longitud de rafaga (con i2c_isr_state() el byte 128 de una
+ * escritura llega como 0x80 y se tomaba por una lectura)
+ */
+#INT_SSP
+void PixI2CISR(void){
+int Dato;
+
+	if(PixI2CLectura){
+		if(!PixI2CEsDato)
+			Dato = i2c_read(2);		//direccion: sin soltar el reloj, ahora hay que responder
+		i2c_write(PixI2CLeer(PixI2CReg++));
+		return;
+	}
+
+	if(!PixI2CLleno) return;		//NACK del maestro al final de una lectura: no hay byte
+	Dato = i2c_read();
+
+	if(!PixI2CEsDato){
+		PixI2CBytesDir = 0;			//direccion de esclavo: empieza una escritura
+		return;
+	}
+
+	if(PixI2CBytesDir < PIX_I2C_BYTES_DIR){
+	#ifdef PIX_I2C_DIR16
+		if(PixI2CBytesDir == 0) PixI2CReg = make16(Dato, 0);
+		else PixI2CReg |= Dato;
+	#else
+		PixI2CReg = Dato;
+	#endif
+		PixI2CBytesDir++;
+	}else{
+		PixI2CEscribir(PixI2CReg++, Dato);
+	}
+}
+
+/*
+ * Habilita la interrupcion del esclavo I2C
+ */
+void InitI2C(void){
+	PixI2CReg = 0;
+	PixI2CBytesDir = 0;
+	PixI2CPend = 0;
+	clear_interrupt(INT_SSP);
+	enable_interrupts(INT_SSP);
+}
+
+/*
+ * Ejecuta las ordenes recibidas por I2C. Solo con el bus parado (despues del
+ * STOP), para no desactivar las interrupciones en mitad de una transaccion
+ */
+short AtenderI2C(void){
+int Pend;
+
+	if((PixI2CPend == 0) || !PixI2CParada) return FALSE;	//nada que hacer o bus ocupado
+
+	//se recogen y se borran de una vez: lo que llegue mientras tanto queda
+	//para la siguiente llamada
+	disable_interrupts(INT_SSP);
+	Pend = PixI2CPend;
+	PixI2CPend = PIX_I2C_TRABAJANDO;
+	enable_interrupts(INT_SSP);
+
+	//en este orden: el relleno ya sale con el brillo nuevo
+	if(Pend & PIX_I2C_PEND_BRILLO){
+		CambiarBrillo(PixI2CBrillo);
+	}
+	if(Pend & PIX_I2C_PEND_RELLENAR){
+		LlenarDeColor(0, PIX_NUM_LEDS - 1, Color32(PixI2CColor[0], PixI2CColor[1], PixI2CColor[2]));
+	}
+	if(Pend & PIX_I2C_PEND_MOSTRAR){
+		MostrarPixels();
+	}
+
+	disable_interrupts(INT_SSP);
+	PixI2CPend &= ~PIX_I2C_TRABAJANDO;
+	enable_interrupts(INT_SSP);
+
+	return (Pend & PIX_I2C_PEND_MOSTRAR) != 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * File:   led_pixels_i2c.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * El PIC como coprocesador de LEDs: esclavo I2C (MSSP) que presenta Pixels[]
+ * como un mapa de registros. Otro micro escribe los colores directamente en
+ * el buffer y pide rellenar, cambiar el brillo o mostrar.
+ *
+ * Cada transaccion de escritura empieza por la direccion de registro y sigue
+ * con los datos, que se guardan con autoincremento. Una lectura devuelve los
+ * registros desde la ultima direccion escrita. Los bytes de Pixels[] se
+ * escriben desde la interrupcion tal cual, sin pasar por SetPixelColor(): van
+ * en el orden de los LEDs (GRB, o RGB con PIX_RGB) y no se les aplica Brillo.
+ *
+ * Registros:
+ * 0x00  ESTADO	(R)	bit 0: mostrar pendiente, 1: rellenar, 2: brillo,
+ * 					7: AtenderI2C() ejecutando. 0 = todo hecho
+ * 0x01  BRILLO	(R/W)	mismo valor que CambiarBrillo()
+ * 0x02  ROJO		(R/W)	color para RELLENAR
+ * 0x03  VERDE		(R/W)
+ * 0x04  AZUL		(R/W)
+ * 0x05  RELLENAR	(W)	cualquier valor: todos los LEDs del color 0x02-0x04
+ * 0x06  MOSTRAR	(W)	cualquier valor: MostrarPixels()
+ * 0x07  LEDS_L	(R)	PIX_NUM_LEDS
+ * 0x08  LEDS_H	(R)
+ * 0x10...			(R/W)	Pixels[0], Pixels[1]...
+ *
+ * Si el buffer no cabe en 0x10-0xFF la direccion de registro es de 16 bits
+ * (primero el byte alto). PIX_I2C_DIR16 indica cual se usa.
+ * Ejemplo: rellenar de rojo y mostrar = 02 FF 00 00 01 01
+ *
+ * Rellenar, cambiar el brillo y mostrar no se hacen en la interrupcion: se
+ * marcan y los ejecuta AtenderI2C() desde el bucle principal, y solo despues
+ * de la condicion de STOP. Asi el tiempo con las interrupciones desactivadas
+ * de MostrarPixels() nunca cae en mitad de una transaccion estirando el
+ * reloj. Despues de escribir MOSTRAR el maestro tiene que esperar un tiempo
+ * fijo antes de la siguiente transaccion: PIX_FRAME_US, mas lo que tarde el
+ * bucle principal en llamar a AtenderI2C() y el relleno o el brillo si van
+ * en la misma orden. No hay que leer ESTADO hasta que valga 0: esa lectura
+ * puede caer en el envio, con las interrupciones desactivadas, y el PIC
+ * estira SCL hasta que termina. ESTADO sirve para comprobar despues de la
+ * espera que todo se ha hecho.
+ *
+ * Las rafagas pueden tener cualquier longitud: la fase de cada byte
+ * (direccion, escritura o lectura) sale de los bits D/A y R/W de SSPSTAT,
+ * no de un contador de bytes.
+ *
+ * Solo para PICs con MSSP (no el modulo I2C nuevo de los PIC18 Q).
+ * ----------------------------------------------------------------------------
+ *
+ * Uso:
+ * #define PIX_I2C_DIR		0x40		//direccion de 8 bits (7 bits << 1)
+ * #include "led_pixels.c"
+ * #include "led_pixels_i2c.c"
+ *
+ * InitPixels();
+ * InitI2C();
+ * enable_interrupts(GLOBAL);
+ * while(TRUE){
+ * 	AtenderI2C();
+ * }
+ * ---------------------------------------------------------------------------*/
+
+/* --------------------------------- FUNCIONES --------------------------------
+ *
+ * -InitI2C()
+ * Habilita la interrupcion del MSSP. Las globales las habilita el programa
+ *
+ * -AtenderI2C()
+ * Ejecuta las ordenes pendientes (brillo, rellenar, mostrar) si el bus esta
+ * libre. Llamar en el bucle principal. Devuelve TRUE si ha mostrado
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_I2C_H
+#define	LED_PIXELS_I2C_H
+
+#ifndef PIX_I2C_DIR
+	#error "Define PIX_I2C_DIR con la direccion de esclavo"
+#endif
+#if !getenv("SFR_VALID:SSP1STAT") && !getenv("SFR_VALID:SSPSTAT")
+	#error "led_pixels_i2c.c necesita un MSSP"
+#endif
+
+//Mapa de registros
+#define PIX_I2C_ESTADO		0x00
+#define PIX_I2C_BRILLO		0x01
+#define PIX_I2C_ROJO		0x02
+#define PIX_I2C_VERDE		0x03
+#define PIX_I2C_AZUL		0x04
+#define PIX_I2C_RELLENAR	0x05
+#define PIX_I2C_MOSTRAR		0x06
+#define PIX_I2C_LEDS_L		0x07
+#define PIX_I2C_LEDS_H		0x08
+#define PIX_I2C_PIXELS		0x10
+
+//Bits de ESTADO y de las ordenes pendientes
+#define PIX_I2C_PEND_MOSTRAR	0x01
+#define PIX_I2C_PEND_RELLENAR	0x02
+#define PIX_I2C_PEND_BRILLO		0x04
+#define PIX_I2C_TRABAJANDO		0x80
+
+#if (PIX_I2C_PIXELS + PIX_NUM_BYTES) > 256
+	#define PIX_I2C_DIR16
+	typedef long PixI2CDir;
+#else
+	typedef int PixI2CDir;
+#endif
+
+/* REGISTROS */
+#if getenv("SFR_VALID:SSP1STAT")
+#byte PIX_SSPSTAT	= getenv("SFR:SSP1STAT")
+#else
+#byte PIX_SSPSTAT	= getenv("SFR:SSPSTAT")
+#endif
+#bit PixI2CParada	= PIX_SSPSTAT.4		//P: lo ultimo que ha pasado en el bus es un STOP
+#bit PixI2CEsDato	= PIX_SSPSTAT.5		//D/A: el ultimo byte es de datos (0 = direccion de esclavo)
+#bit PixI2CLectura	= PIX_SSPSTAT.2		//R/W: transaccion de lectura en curso
+#bit PixI2CLleno	= PIX_SSPSTAT.0		//BF: hay un byte recibido en SSPBUF
+
+/* VARIABLES */
+PixI2CDir PixI2CReg = 0;		//registro actual (autoincremento)
+int PixI2CBytesDir = 0;			//bytes de direccion de registro recibidos en esta escritura
+int PixI2CPend = 0;				//ordenes pendientes para AtenderI2C()
+int PixI2CBrillo = 255;			//ultimo brillo pedido
+int PixI2CColor[3] = {0, 0, 0};	//color para RELLENAR (R, G, B)
+
+/* PROTOTIPOS */
+void InitI2C(void);
+short AtenderI2C(void);
+
+#endif	/* LED_PIXELS_I2C_H */
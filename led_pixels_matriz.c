@@ -0,0 +1,305 @@
+#include <led_pixels_matriz.h>
+
+int PixHueco[3];	//destino de las escrituras fuera de la matriz o en huecos de la tabla
+
+#ifndef PIX_MATRIZ_TABLA
+//Sentido fisico (en el cableado) de cada sentido de la imagen segun el giro
+#if PIX_MATRIZ_ROTACION == 0
+const int PixGiro[4] = {PIX_DIR_X, PIX_DIR_XN, PIX_DIR_Y, PIX_DIR_YN};
+#elif PIX_MATRIZ_ROTACION == 90
+const int PixGiro[4] = {PIX_DIR_YN, PIX_DIR_Y, PIX_DIR_X, PIX_DIR_XN};
+#elif PIX_MATRIZ_ROTACION == 180
+const int PixGiro[4] = {PIX_DIR_XN, PIX_DIR_X, PIX_DIR_YN, PIX_DIR_Y};
+#else
+const int PixGiro[4] = {PIX_DIR_Y, PIX_DIR_YN, PIX_DIR_XN, PIX_DIR_X};
+#endif
+
+/*
+ * Pasa (x, y) de la imagen a columna (fx) y fila (fy) del cableado, sin
+ * tener en cuenta la serpentina
+ */
+#inline
+void PixFisico(int x, int y, int *fx, int *fy){
+#if PIX_MATRIZ_ROTACION == 0
+	*fx = x;
+	*fy = y;
+#elif PIX_MATRIZ_ROTACION == 90
+	*fx = y;
+	*fy = PIX_MATRIZ_ALTO - 1 - x;
+#elif PIX_MATRIZ_ROTACION == 180
+	*fx = PIX_MATRIZ_ANCHO - 1 - x;
+	*fy = PIX_MATRIZ_ALTO - 1 - y;
+#else
+	*fx = PIX_MATRIZ_ANCHO - 1 - y;
+	*fy = x;
+#endif
+}
+#endif
+
+/*
+ * Devuelve el indice del LED en la posicion (x, y) de la imagen
+ * Fuera de la matriz (o en un hueco de la tabla) devuelve PIX_NUM_LEDS, que
+ * SetPixelColor() ignora
+ */
+PixIndice PixXY(int x, int y){
+	if((x >= PIX_XY_ANCHO) || (y >= PIX_XY_ALTO)) return PIX_NUM_LEDS;
+
+#ifdef PIX_MATRIZ_TABLA
+	return PixMapa[_mul(y, PIX_XY_ANCHO) + x];
+#else
+	int fx, fy;
+	PixFisico(x, y, &fx, &fy);
+
+	#ifdef PIX_MATRIZ_SERPENTINA
+	if(bit_test(fy, 0)) fx = PIX_MATRIZ_ANCHO - 1 - fx;	//filas impares al reves
+	#endif
+
+	return _mul(fy, PIX_MATRIZ_ANCHO) + fx;
+#endif
+}
+
+/*
+ * Devuelve un puntero a los 3 bytes del LED en (x, y), o a PixHueco si no existe
+ */
+int *PixPuntero(int x, int y){
+PixIndice n;
+
+	n = PixXY(x, y);
+	if(n >= PIX_NUM_LEDS) return PixHueco;
+	return &Pixels[(PixNumByte)n * 3];
+}
+
+/*
+ * Prepara un recorrido desde (x, y) en el sentido Dir (PIX_DIR_*)
+ * Sin tabla el indice solo se calcula aqui; despues se avanza sumando el paso
+ */
+void PixRecorrer(PixRecorrido *r, int x, int y, int Dir){
+	r->p = PixPuntero(x, y);
+
+#ifdef PIX_MATRIZ_TABLA
+	r->x = x;
+	r->y = y;
+	r->Dir = Dir;
+#else
+	int fx, fy;
+	PixFisico(x, y, &fx, &fy);
+
+	switch(PixGiro[Dir]){
+		case PIX_DIR_X:
+			r->Paso = 3;
+			break;
+		case PIX_DIR_XN:
+			r->Paso = -3;
+			break;
+		case PIX_DIR_Y:
+	#ifdef PIX_MATRIZ_SERPENTINA
+			//de fila par a impar se salta al otro extremo, y al reves
+			if(bit_test(fy, 0)){
+				r->Paso = 3 * (2 * (signed long)fx + 1);
+				r->Otro = 3 * (2 * (signed long)(PIX_MATRIZ_ANCHO - fx) - 1);
+			}else{
+				r->Paso = 3 * (2 * (signed long)(PIX_MATRIZ_ANCHO - fx) - 1);
+				r->Otro = 3 * (2 * (signed long)fx + 1);
+			}
+			return;
+	#else
+			r->Paso = 3 * PIX_MATRIZ_ANCHO;
+			break;
+	#endif
+		default:	//PIX_DIR_YN
+	#ifdef PIX_MATRIZ_SERPENTINA
+			if(bit_test(fy, 0)){
+				r->Paso = -3 * (2 * (signed long)(PIX_MATRIZ_ANCHO - fx) - 1);
+				r->Otro = -3 * (2 * (signed long)fx + 1);
+			}else{
+				r->Paso = -3 * (2 * (signed long)fx + 1);
+				r->Otro = -3 * (2 * (signed long)(PIX_MATRIZ_ANCHO - fx) - 1);
+			}
+			return;
+	#else
+			r->Paso = -3 * PIX_MATRIZ_ANCHO;
+			break;
+	#endif
+	}
+
+	#ifdef PIX_MATRIZ_SERPENTINA
+	//en las filas impares el cableado va al reves
+	if(bit_test(fy, 0)) r->Paso = -r->Paso;
+	#endif
+	r->Otro = r->Paso;
+#endif
+}
+
+/*
+ * Avanza el recorrido al siguiente pixel
+ */
+#inline
+void PixAvanzar(PixRecorrido *r){
+#ifdef PIX_MATRIZ_TABLA
+	switch(r->Dir){
+		case PIX_DIR_X:		r->x++; break;
+		case PIX_DIR_XN:	r->x--; break;
+		case PIX_DIR_Y:		r->y++; break;
+		default:			r->y--; break;
+	}
+	r->p = PixPuntero(r->x, r->y);
+#else
+	signed long t;
+
+	r->p += r->Paso;
+	t = r->Paso;
+	r->Paso = r->Otro;
+	r->Otro = t;
+#endif
+}
+
+/*
+ * Pinta (Largo) pixels desde (x, y) en el sentido Dir con el color ya preparado
+ */
+void PixLlenarLinea(int x, int y, int Dir, int Largo, int *Col){
+PixRecorrido r;
+
+	PixRecorrer(&r, x, y, Dir);
+	while(Largo--){
+		r.p[0] = Col[0];
+		r.p[1] = Col[1];
+		r.p[2] = Col[2];
+		PixAvanzar(&r);
+	}
+}
+
+/*
+ * Escribe el color RGB en el LED de la posicion (x, y)
+ */
+void SetPixelXY(int x, int y, int r, int g, int b){
+	SetPixelColor(PixXY(x, y), r, g, b);
+}
+
+/*
+ * Escribe el color (c) en el LED de la posicion (x, y)
+ */
+void SetPixelXY(int x, int y, int32 c){
+	SetPixelColor(PixXY(x, y), c);
+}
+
+/*
+ * Lee el color del LED de la posicion (x, y)
+ */
+int32 GetPixelXY(int x, int y){
+	return GetPixelColor(PixXY(x, y));
+}
+
+/*
+ * Rellena la fila (y) de la imagen
+ */
+void LlenarFila(int y, int32 c){
+int Col[3];
+
+	if(y >= PIX_XY_ALTO) return;
+	PixPrepararColor(c, Col);
+	PixLlenarLinea(0, y, PIX_DIR_X, PIX_XY_ANCHO, Col);
+	PIX_BUFFER_TOCADO();
+}
+
+/*
+ * Rellena la columna (x) de la imagen
+ */
+void LlenarColumna(int x, int32 c){
+int Col[3];
+
+	if(x >= PIX_XY_ANCHO) return;
+	PixPrepararColor(c, Col);
+	PixLlenarLinea(x, 0, PIX_DIR_Y, PIX_XY_ALTO, Col);
+	PIX_BUFFER_TOCADO();
+}
+
+/*
+ * Rellena el rectangulo de (Ancho x Alto) con esquina en (x, y)
+ * Se recorta una vez al principio; dentro solo se avanza por filas
+ */
+void LlenarRect(int x, int y, int Ancho, int Alto, int32 c){
+int Col[3];
+
+	if((x >= PIX_XY_ANCHO) || (y >= PIX_XY_ALTO)) return;
+	if(Ancho > (PIX_XY_ANCHO - x)) Ancho = PIX_XY_ANCHO - x;
+	if(Alto > (PIX_XY_ALTO - y)) Alto = PIX_XY_ALTO - y;
+	if(Ancho == 0) return;
+
+	PixPrepararColor(c, Col);
+	while(Alto--){
+		PixLlenarLinea(x, y++, PIX_DIR_X, Ancho, Col);
+	}
+	PIX_BUFFER_TOCADO();
+}
+
+/*
+ * Mueve una linea de (Largo) pixels una posicion hacia (x, y): cada pixel
+ * toma el valor del siguiente en el sentido Dir y el ultimo se pone en negro
+ */
+void PixDesplazarLinea(int x, int y, int Dir, int Largo){
+PixRecorrido d, s;
+
+	PixRecorrer(&d, x, y, Dir);
+	PixRecorrer(&s, x, y, Dir);
+	PixAvanzar(&s);
+
+	while(--Largo){
+		d.p[0] = s.p[0];
+		d.p[1] = s.p[1];
+		d.p[2] = s.p[2];
+		PixAvanzar(&d);
+		PixAvanzar(&s);
+	}
+
+	d.p[0] = 0;
+	d.p[1] = 0;
+	d.p[2] = 0;
+}
+
+/*
+ * Mueve la imagen un pixel a la izquierda; la ultima columna queda en negro
+ */
+void DesplazarIzquierda(void){
+int y;
+
+	for(y = 0; y < PIX_XY_ALTO; y++){
+		PixDesplazarLinea(0, y, PIX_DIR_X, PIX_XY_ANCHO);
+	}
+	PIX_BUFFER_TOCADO();
+}
+
+/*
+ * Mueve la imagen un pixel a la derecha; la primera columna queda en negro
+ */
+void DesplazarDerecha(void){
+int y;
+
+	for(y = 0; y < PIX_XY_ALTO; y++){
+		PixDesplazarLinea(PIX_XY_ANCHO - 1, y, PIX_DIR_XN, PIX_XY_ANCHO);
+	}
+	PIX_BUFFER_TOCADO();
+}
+
+/*
+ * Mueve la imagen un pixel hacia arriba; la ultima fila queda en negro
+ */
+void DesplazarArriba(void){
+int x;
+
+	for(x = 0; x < PIX_XY_ANCHO; x++){
+		PixDesplazarLinea(x, 0, PIX_DIR_Y, PIX_XY_ALTO);
+	}
+	PIX_BUFFER_TOCADO();
+}
+
+/*
+ * Mueve la imagen un pixel hacia abajo; la primera fila queda en negro
+ */
+void DesplazarAbajo(void){
+int x;
+
+	for(x = 0; x < PIX_XY_ANCHO; x++){
+		PixDesplazarLinea(x, PIX_XY_ALTO - 1, PIX_DIR_YN, PIX_XY_ALTO);
+	}
+	PIX_BUFFER_TOCADO();
+}
@@ -0,0 +1,126 @@
+/*
+ * File:   led_pixels_matriz.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Acceso a Pixels[] por coordenadas (x, y) para matrices de LEDs.
+ *
+ * La disposicion fisica se describe en tiempo de compilacion: LEDs por fila
+ * tal como estan cableados (PIX_MATRIZ_ANCHO), numero de filas
+ * (PIX_MATRIZ_ALTO), si las filas van en zigzag (PIX_MATRIZ_SERPENTINA) y un
+ * giro de la imagen en sentido horario (PIX_MATRIZ_ROTACION 0/90/180/270).
+ * Con 90 y 270 grados la imagen queda de PIX_MATRIZ_ALTO x PIX_MATRIZ_ANCHO.
+ * PIX_XY_ANCHO y PIX_XY_ALTO son siempre el tamaño de la imagen ya girada.
+ *
+ * Para cualquier otra disposicion (anillos, formas, huecos) se define
+ * PIX_MATRIZ_TABLA y el programa declara en ROM el indice de LED de cada
+ * posicion, fila a fila. Las posiciones sin LED llevan PIX_NUM_LEDS:
+ * const PixIndice PixMapa[PIX_MATRIZ_ALTO * PIX_MATRIZ_ANCHO] = {...};
+ *
+ * Las filas, columnas, rectangulos y desplazamientos no calculan el indice de
+ * cada pixel: se calcula el primero y se avanza por el buffer con un paso
+ * fijo (en serpentina las columnas alternan dos pasos). El color se escala y
+ * se ordena una sola vez por llamada.
+ * ----------------------------------------------------------------------------
+ *
+ * Uso:
+ * #define PIX_NUM_LEDS			64
+ * #define PIX_MATRIZ_ANCHO		8
+ * #define PIX_MATRIZ_ALTO		8
+ * #define PIX_MATRIZ_SERPENTINA
+ * #include "led_pixels.c"
+ * #include "led_pixels_matriz.c"
+ *
+ * SetPixelXY(3, 4, PIX_ROJO);
+ * LlenarRect(0, 0, 4, 2, PIX_AZUL);
+ * DesplazarIzquierda();
+ * ---------------------------------------------------------------------------*/
+
+/* --------------------------------- FUNCIONES --------------------------------
+ *
+ * -PixXY(int x, int y)
+ * Devuelve el indice del LED en (x, y), o PIX_NUM_LEDS si esta fuera
+ *
+ * -SetPixelXY(int x, int y, int r, int g, int b)
+ * -SetPixelXY(int x, int y, int32 c)
+ * -GetPixelXY(int x, int y)
+ * Igual que SetPixelColor() / GetPixelColor() por coordenadas
+ *
+ * -LlenarFila(int y, int32 c)
+ * -LlenarColumna(int x, int32 c)
+ * -LlenarRect(int x, int y, int Ancho, int Alto, int32 c)
+ * Rellenan de un color. El rectangulo se recorta a la matriz
+ *
+ * -DesplazarIzquierda() / DesplazarDerecha() / DesplazarArriba() / DesplazarAbajo()
+ * Mueven la imagen un pixel. La fila o columna que queda libre se pone en negro
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_MATRIZ_H
+#define	LED_PIXELS_MATRIZ_H
+
+#if !defined(PIX_MATRIZ_ANCHO) || !defined(PIX_MATRIZ_ALTO)
+	#error "Define PIX_MATRIZ_ANCHO y PIX_MATRIZ_ALTO"
+#endif
+#if (PIX_MATRIZ_ANCHO > 255) || (PIX_MATRIZ_ALTO > 255)
+	#error "PIX_MATRIZ_ANCHO y PIX_MATRIZ_ALTO tienen que ser menores de 256"
+#endif
+
+#ifndef PIX_MATRIZ_ROTACION
+	#define PIX_MATRIZ_ROTACION		0
+#endif
+
+#ifdef PIX_MATRIZ_TABLA
+	//la tabla ya esta en coordenadas de la imagen
+	#define PIX_XY_ANCHO	PIX_MATRIZ_ANCHO
+	#define PIX_XY_ALTO		PIX_MATRIZ_ALTO
+#else
+	#if (PIX_MATRIZ_ANCHO * PIX_MATRIZ_ALTO) > PIX_NUM_LEDS
+		#error "La matriz tiene mas LEDs que PIX_NUM_LEDS"
+	#endif
+	#if (PIX_MATRIZ_ROTACION == 0) || (PIX_MATRIZ_ROTACION == 180)
+		#define PIX_XY_ANCHO	PIX_MATRIZ_ANCHO
+		#define PIX_XY_ALTO		PIX_MATRIZ_ALTO
+	#elif (PIX_MATRIZ_ROTACION == 90) || (PIX_MATRIZ_ROTACION == 270)
+		#define PIX_XY_ANCHO	PIX_MATRIZ_ALTO
+		#define PIX_XY_ALTO		PIX_MATRIZ_ANCHO
+	#else
+		#error "PIX_MATRIZ_ROTACION tiene que ser 0, 90, 180 o 270"
+	#endif
+#endif
+
+//Sentidos de recorrido en coordenadas de la imagen
+#define PIX_DIR_X		0	//x creciente
+#define PIX_DIR_XN		1	//x decreciente
+#define PIX_DIR_Y		2	//y creciente
+#define PIX_DIR_YN		3	//y decreciente
+
+/* TIPOS */
+//Puntero que avanza por una fila o columna de la imagen
+typedef struct{
+	int *p;				//3 bytes del pixel actual
+#ifdef PIX_MATRIZ_TABLA
+	int x, y;			//posicion actual (con tabla cada paso se busca en ella)
+	int Dir;
+#else
+	signed long Paso;	//bytes hasta el siguiente pixel
+	signed long Otro;	//paso siguiente (en serpentina las columnas alternan dos)
+#endif
+}PixRecorrido;
+
+/* PROTOTIPOS */
+PixIndice PixXY(int x, int y);
+void SetPixelXY(int x, int y, int r, int g, int b);
+void SetPixelXY(int x, int y, int32 c);
+int32 GetPixelXY(int x, int y);
+void LlenarFila(int y, int32 c);
+void LlenarColumna(int x, int32 c);
+void LlenarRect(int x, int y, int Ancho, int Alto, int32 c);
+void DesplazarIzquierda(void);
+void DesplazarDerecha(void);
+void DesplazarArriba(void);
+void DesplazarAbajo(void);
+
+#endif	/* LED_PIXELS_MATRIZ_H */
@@ -0,0 +1,141 @@
+#include <led_pixels_ruido.h>
+
+//Permutacion de 0-255 (la del ruido de Perlin): da el valor de cada esquina
+const int PixPerm[256] = {
+	151, 160, 137,  91,  90,  15, 131,  13, 201,  95,  96,  53, 194, 233,   7, 225,
+	140,  36, 103,  30,  69, 142,   8,  99,  37, 240,  21,  10,  23, 190,   6, 148,
+	247, 120, 234,  75,   0,  26, 197,  62,  94, 252, 219, 203, 117,  35,  11,  32,
+	 57, 177,  33,  88, 237, 149,  56,  87, 174,  20, 125, 136, 171, 168,  68, 175,
+	 74, 165,  71, 134, 139,  48,  27, 166,  77, 146, 158, 231,  83, 111, 229, 122,
+	 60, 211, 133, 230, 220, 105,  92,  41,  55,  46, 245,  40, 244, 102, 143,  54,
+	 65,  25,  63, 161,   1, 216,  80,  73, 209,  76, 132, 187, 208,  89,  18, 169,
+	200, 196, 135, 130, 116, 188, 159,  86, 164, 100, 109, 198, 173, 186,   3,  64,
+	 52, 217, 226, 250, 124, 123,   5, 202,  38, 147, 118, 126, 255,  82,  85, 212,
+	207, 206,  59, 227,  47,  16,  58,  17, 182, 189,  28,  42, 223, 183, 170, 213,
+	119, 248, 152,   2,  44, 154, 163,  70, 221, 153, 101, 155, 167,  43, 172,   9,
+	129,  22,  39, 253,  19,  98, 108, 110,  79, 113, 224, 232, 178, 185, 112, 104,
+	218, 246,  97, 228, 251,  34, 242, 193, 238, 210, 144,  12, 191, 179, 162, 241,
+	 81,  51, 145, 235, 249,  14, 239, 107,  49, 192, 214,  31, 181, 199, 106, 157,
+	184,  84, 204, 176, 115, 121,  50,  45, 127,   4, 150, 254, 138, 236, 205,  93,
+	222, 114,  67,  29,  24,  72, 243, 141, 128, 195,  78,  66, 215,  61, 156, 180
+};
+
+//Curva suave 255 * (3t^2 - 2t^3) con t = i/255: sin saltos de pendiente al
+//cruzar de una celda a otra
+const int PixSuave[256] = {
+	  0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   2,   2,   2,   3,
+	  3,   3,   4,   4,   4,   5,   5,   6,   6,   7,   7,   8,   9,   9,  10,  10,
+	 11,  12,  12,  13,  14,  15,  15,  16,  17,  18,  18,  19,  20,  21,  22,  23,
+	 24,  25,  26,  27,  27,  28,  29,  30,  31,  33,  34,  35,  36,  37,  38,  39,
+	 40,  41,  42,  44,  45,  46,  47,  48,  50,  51,  52,  53,  54,  56,  57,  58,
+	 60,  61,  62,  63,  65,  66,  67,  69,  70,  72,  73,  74,  76,  77,  78,  80,
+	 81,  83,  84,  85,  87,  88,  90,  91,  93,  94,  96,  97,  98, 100, 101, 103,
+	104, 106, 107, 109, 110, 112, 113, 115, 116, 118, 119, 121, 122, 124, 125, 127,
+	128, 130, 131, 133, 134, 136, 137, 139, 140, 142, 143, 145, 146, 148, 149, 151,
+	152, 154, 155, 157, 158, 159, 161, 162, 164, 165, 167, 168, 170, 171, 172, 174,
+	175, 177, 178, 179, 181, 182, 183, 185, 186, 188, 189, 190, 192, 193, 194, 195,
+	197, 198, 199, 201, 202, 203, 204, 205, 207, 208, 209, 210, 211, 213, 214, 215,
+	216, 217, 218, 219, 220, 221, 222, 224, 225, 226, 227, 228, 228, 229, 230, 231,
+	232, 233, 234, 235, 236, 237, 237, 238, 239, 240, 240, 241, 242, 243, 243, 244,
+	245, 245, 246, 246, 247, 248, 248, 249, 249, 250, 250, 251, 251, 251, 252, 252,
+	252, 253, 253, 253, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255
+};
+
+/*
+ * Valor de la esquina (x, y) de la rejilla. La suma desborda a proposito
+ */
+#inline
+int PixEsquina(int x, int y){
+	return PixPerm[(int)(PixPerm[x] + y)];
+}
+
+/*
+ * Ruido de la columna x ya interpolado en y (y = celda, Ey = curva en y)
+ */
+int PixColumna(int x, int y, int Ey){
+	return Mezclar8(PixEsquina(x, y), PixEsquina(x, y + 1), Ey);
+}
+
+/*
+ * Ruido 1D en x (8.8)
+ */
+int Ruido8(long x){
+int c;
+
+	c = make8(x, 1);
+	return Mezclar8(PixPerm[c], PixPerm[(int)(c + 1)], PixSuave[make8(x, 0)]);
+}
+
+/*
+ * Ruido 2D en (x, y), ambos en 8.8
+ */
+int Ruido8XY(long x, long y){
+int c, Ey;
+
+	c = make8(x, 1);
+	Ey = PixSuave[make8(y, 0)];
+	return Mezclar8(PixColumna(c, make8(y, 1), Ey), PixColumna(c + 1, make8(y, 1), Ey), PixSuave[make8(x, 0)]);
+}
+
+/*
+ * Prepara el recorrido de una linea desde (x, y) con avance Paso
+ */
+void PixRuidoIniciar(PixRuidoLinea *r, long x, long Paso, long y){
+	r->x = x;
+	r->Paso = Paso;
+	r->y = make8(y, 1);
+	r->Ey = PixSuave[make8(y, 0)];
+	r->c0 = PixColumna(make8(x, 1), r->y, r->Ey);
+	r->c1 = PixColumna(make8(x, 1) + 1, r->y, r->Ey);
+}
+
+/*
+ * Devuelve el ruido en la posicion actual y avanza al siguiente pixel
+ * Dentro de una celda solo cambia la parte fraccionaria; al pasar a la
+ * siguiente se reutiliza el lado que ya estaba calculado
+ */
+int PixRuidoSiguiente(PixRuidoLinea *r){
+int v, Celda;
+
+	v = Mezclar8(r->c0, r->c1, PixSuave[make8(r->x, 0)]);
+
+	Celda = make8(r->x, 1);
+	r->x += r->Paso;
+	if(make8(r->x, 1) != Celda){
+		Celda++;
+		if(make8(r->x, 1) == Celda){
+			r->c0 = r->c1;	//celda contigua: un lado ya esta
+		}else{
+			Celda = make8(r->x, 1);
+			r->c0 = PixColumna(Celda, r->y, r->Ey);
+		}
+		r->c1 = PixColumna(Celda + 1, r->y, r->Ey);
+	}
+
+	return v;
+}
+
+/*
+ * Escribe n valores de ruido en Destino[] desde (x, y), avanzando Paso en x
+ */
+void RuidoLinea(int *Destino, PixIndice n, long x, long Paso, long y){
+PixRuidoLinea r;
+
+	PixRuidoIniciar(&r, x, Paso, y);
+	while(n--){
+		*Destino++ = PixRuidoSiguiente(&r);
+	}
+}
+
+/*
+ * Pinta cada LED con el color de la rueda que corresponde a su ruido
+ */
+void LlenarRuido(long x, long Paso, long y){
+PixRuidoLinea r;
+PixIndice i;
+
+	PixRuidoIniciar(&r, x, Paso, y);
+	for(i = 0; i < PIX_NUM_LEDS; i++){
+		SetPixelColor(i, Wheel(PixRuidoSiguiente(&r)));
+	}
+}
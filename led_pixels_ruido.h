@@ -0,0 +1,82 @@
+/*
+ * File:   led_pixels_ruido.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Ruido de valor de 8 bits en 1D y 2D para efectos organicos (fuego, plasma,
+ * agua, nubes).
+ *
+ * Las coordenadas son de 16 bits en formato 8.8: el byte alto es la celda de
+ * la rejilla y el bajo la posicion dentro de ella. Cada esquina de la rejilla
+ * toma un valor pseudoaleatorio de la tabla de permutacion (ROM) y entre
+ * esquinas se interpola con una curva suave (3t^2 - 2t^3, tambien en ROM).
+ * Las interpolaciones usan Mezclar8(), asi que no hay multiplicaciones de 16
+ * bits ni llamadas a _mul().
+ *
+ * Mezclar8() si multiplica: en PIC16 es la suma y desplazamiento de 8 pasos
+ * de Escalar8() (36 ciclos, ~45 con la mezcla). Una mezcla por tabla
+ * necesitaria una entrada por cada diferencia y cada t (64KB), y con menos
+ * pasos de t la curva suave se ve a escalones. Con una sola mezcla por pixel
+ * cabe de sobra en el fotograma, como se ve abajo.
+ *
+ * Para una tira entera, RuidoLinea() y LlenarRuido() no evaluan cada pixel
+ * desde cero: en 2D la interpolacion en y es la misma para toda la linea y
+ * solo se calcula al cambiar de celda; por pixel solo se suma el paso a x, se
+ * busca la curva y se hace una mezcla.
+ *
+ * Ciclos por pixel de RuidoLinea() en PIC16 (tools/pix_ruido.c, con los
+ * ciclos de Mezclar8 de led_pixels.c): ~124 con paso 40 (un cambio de celda
+ * cada 6 LEDs) y 327 en el peor caso (paso de 2 celdas o mas, tres mezclas
+ * por pixel). 85 LEDs a 30 FPS con 32 MHz dejan ~2890 ciclos por pixel
+ * despues del envio, asi que el ruido usa el 4% (11% en el peor caso). La
+ * cifra real en la placa la da la fila RuidoLinea de bench.c.
+ * ----------------------------------------------------------------------------
+ *
+ * Uso:
+ * #include "led_pixels.c"
+ * #include "led_pixels_ruido.c"
+ *
+ * long t = 0;
+ * while(TRUE){
+ * 	LlenarRuido(0, 40, t);	//x desde 0, 40/256 de celda por LED, y = tiempo
+ * 	MostrarPixels();
+ * 	t += 8;
+ * }
+ * ---------------------------------------------------------------------------*/
+
+/* --------------------------------- FUNCIONES --------------------------------
+ *
+ * -Ruido8(long x)
+ * -Ruido8XY(long x, long y)
+ * Valor del ruido (0-255) en un punto
+ *
+ * -RuidoLinea(int *Destino, PixIndice n, long x, long Paso, long y)
+ * Escribe en Destino[] n valores de ruido desde (x, y), avanzando Paso en x
+ *
+ * -LlenarRuido(long x, long Paso, long y)
+ * Igual que RuidoLinea() pero pinta cada LED con Wheel(ruido)
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_RUIDO_H
+#define	LED_PIXELS_RUIDO_H
+
+/* TIPOS */
+//Estado del recorrido incremental de una linea
+typedef struct{
+	long x;			//posicion actual (8.8)
+	long Paso;		//avance por pixel (8.8)
+	int y;			//celda en y
+	int Ey;			//curva en y, fija para toda la linea
+	int c0, c1;		//ruido en los dos lados de la celda actual, ya mezclado en y
+}PixRuidoLinea;
+
+/* PROTOTIPOS */
+int Ruido8(long x);
+int Ruido8XY(long x, long y);
+void RuidoLinea(int *Destino, PixIndice n, long x, long Paso, long y);
+void LlenarRuido(long x, long Paso, long y);
+
+#endif	/* LED_PIXELS_RUIDO_H */
@@ -0,0 +1,102 @@
+#include <led_pixels_sprite.h>
+
+int SpriteAncho(rom int *Sprite){
+	return Sprite[PIX_SPRITE_ANCHO];
+}
+
+int SpriteAlto(rom int *Sprite){
+	return Sprite[PIX_SPRITE_ALTO];
+}
+
+/*
+ * Dibuja el sprite con la esquina superior izquierda en (x, y)
+ * Si el sprite tiene mas colores que PIX_SPRITE_COLORES no dibuja nada
+ */
+void Blit(rom int *Sprite, signed long x, signed long y){
+int Ancho, Alto, Num;
+int Desde, Hasta;	//columnas visibles del sprite
+int Fila, Filas;	//filas visibles del sprite
+int i, c;
+int Col[3];
+int *p;
+rom int *s;
+PixRecorrido r;
+
+	Ancho = Sprite[PIX_SPRITE_ANCHO];
+	Alto = Sprite[PIX_SPRITE_ALTO];
+	Num = Sprite[PIX_SPRITE_NUM];
+	if(Num > PIX_SPRITE_COLORES) return;
+
+	//recorte contra la matriz, una sola vez
+	Desde = 0;
+	Hasta = Ancho;
+	if(x < 0){
+		if(-x >= Ancho) return;
+		Desde = -x;
+	}
+	if((x + Ancho) > PIX_XY_ANCHO){
+		if(x >= PIX_XY_ANCHO) return;
+		Hasta = PIX_XY_ANCHO - x;
+	}
+
+	Fila = 0;
+	Filas = Alto;
+	if(y < 0){
+		if(-y >= Alto) return;
+		Fila = -y;
+	}
+	if((y + Alto) > PIX_XY_ALTO){
+		if(y >= PIX_XY_ALTO) return;
+		Filas = PIX_XY_ALTO - y;
+	}
+
+	//paleta con brillo y en el orden del buffer
+	s = Sprite + PIX_SPRITE_PALETA;
+	for(c = 1; c <= Num; c++){
+		PixPrepararColor(Color32(s[0], s[1], s[2]), Col);
+		PixPaleta0[c] = Col[0];
+		PixPaleta1[c] = Col[1];
+		PixPaleta2[c] = Col[2];
+		s += 3;
+	}
+
+	//primer pixel visible
+	s = Sprite + PIX_SPRITE_PALETA + _mul(Num, 3) + _mul(Fila, Ancho) + Desde;
+	Hasta -= Desde;
+
+	for(; Fila < Filas; Fila++){
+		PixRecorrer(&r, x + Desde, y + Fila, PIX_DIR_X);
+
+#ifndef PIX_MATRIZ_TABLA
+		if((r.Paso == 3) && (r.Otro == 3)){
+			//fila seguida en el buffer: puntero con autoincremento
+			p = r.p;
+			for(i = 0; i < Hasta; i++){
+				c = s[i];
+				if(c != 0){
+					*p++ = PixPaleta0[c];
+					*p++ = PixPaleta1[c];
+					*p++ = PixPaleta2[c];
+				}else{
+					p += 3;
+				}
+			}
+		}else
+#endif
+		{
+			for(i = 0; i < Hasta; i++){
+				c = s[i];
+				if(c != 0){
+					r.p[0] = PixPaleta0[c];
+					r.p[1] = PixPaleta1[c];
+					r.p[2] = PixPaleta2[c];
+				}
+				PixAvanzar(&r);
+			}
+		}
+
+		s += Ancho;
+	}
+
+	PIX_BUFFER_TOCADO();
+}
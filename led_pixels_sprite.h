@@ -0,0 +1,87 @@
+/*
+ * File:   led_pixels_sprite.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Sprites en memoria de programa para matrices (necesita led_pixels_matriz.c)
+ *
+ * Formato: un array rom int con la cabecera, la paleta y un byte por pixel,
+ * fila a fila. El indice 0 es transparente (no se escribe) y no lleva color
+ * en la paleta:
+ *
+ * rom int Corazon[] = {
+ * 	5, 4,			//ancho, alto
+ * 	2,				//colores de la paleta (sin contar el transparente)
+ * 	255, 0, 0,		//1: R, G, B
+ * 	255, 128, 128,	//2
+ * 	0, 1, 0, 1, 0,
+ * 	1, 2, 1, 1, 1,
+ * 	0, 1, 1, 1, 0,
+ * 	0, 0, 1, 0, 0
+ * };
+ *
+ * Blit() prepara la paleta una vez por llamada (brillo, balance y orden de
+ * los bytes con PixPrepararColor()), recorta el sprite contra la matriz una
+ * sola vez y despues recorre cada fila visible con un puntero al buffer que
+ * avanza con el paso de la disposicion (PixRecorrer()). Por pixel opaco solo
+ * se lee el indice y se copian 3 bytes de la paleta; si la fila va seguida
+ * en el buffer (sin girar, o filas pares en serpentina) el puntero avanza
+ * con autoincremento.
+ * ----------------------------------------------------------------------------
+ *
+ * Uso:
+ * #define PIX_SPRITE_COLORES	4	//colores maximos por sprite (por defecto 15)
+ * #include "led_pixels.c"
+ * #include "led_pixels_matriz.c"
+ * #include "led_pixels_sprite.c"
+ *
+ * Blit(Corazon, 2, 1);
+ * Blit(Corazon, -3, 1);		//recortado por la izquierda
+ * ---------------------------------------------------------------------------*/
+
+/* --------------------------------- FUNCIONES --------------------------------
+ *
+ * -Blit(rom int *Sprite, signed long x, signed long y)
+ * Dibuja el sprite con la esquina superior izquierda en (x, y). Las partes
+ * fuera de la matriz no se dibujan
+ *
+ * -SpriteAncho(rom int *Sprite) / SpriteAlto(rom int *Sprite)
+ * Tamaño del sprite
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_SPRITE_H
+#define	LED_PIXELS_SPRITE_H
+
+#ifndef LED_PIXELS_MATRIZ_H
+	#error "led_pixels_sprite.c necesita led_pixels_matriz.c"
+#endif
+
+#ifndef PIX_SPRITE_COLORES
+	#define PIX_SPRITE_COLORES	15
+#endif
+#if (PIX_SPRITE_COLORES < 1) || (PIX_SPRITE_COLORES > 255)
+	#error "PIX_SPRITE_COLORES tiene que estar entre 1 y 255"
+#endif
+
+//Posicion de cada parte del sprite
+#define PIX_SPRITE_ANCHO	0
+#define PIX_SPRITE_ALTO		1
+#define PIX_SPRITE_NUM		2
+#define PIX_SPRITE_PALETA	3
+
+/* VARIABLES */
+//Paleta del sprite actual ya preparada, un array por byte del buffer para
+//no multiplicar el indice por 3. La entrada 0 es la transparente
+int PixPaleta0[PIX_SPRITE_COLORES + 1];
+int PixPaleta1[PIX_SPRITE_COLORES + 1];
+int PixPaleta2[PIX_SPRITE_COLORES + 1];
+
+/* PROTOTIPOS */
+void Blit(rom int *Sprite, signed long x, signed long y);
+int SpriteAncho(rom int *Sprite);
+int SpriteAlto(rom int *Sprite);
+
+#endif	/* LED_PIXELS_SPRITE_H */
@@ -0,0 +1,282 @@
+#include <led_pixels_texto.h>
+
+/* FUENTE */
+//Una entrada por columna, bit 0 = fila de arriba
+#ifdef PIX_FUENTE_3X5
+const int PixFuente[] = {
+	0x00, 0x00, 0x00,	//espacio
+	0x00, 0x17, 0x00,	//!
+	0x03, 0x00, 0x03,	//"
+	0x1F, 0x0A, 0x1F,	//#
+	0x12, 0x1F, 0x09,	//$
+	0x19, 0x04, 0x13,	//%
+	0x0A, 0x15, 0x1A,	//&
+	0x00, 0x03, 0x00,	//'
+	0x00, 0x0E, 0x11,	//(
+	0x11, 0x0E, 0x00,	//)
+	0x0A, 0x04, 0x0A,	//*
+	0x04, 0x0E, 0x04,	//+
+	0x10, 0x08, 0x00,	//,
+	0x04, 0x04, 0x04,	//-
+	0x00, 0x10, 0x00,	//.
+	0x18, 0x04, 0x03,	///
+	0x1F, 0x11, 0x1F,	//0
+	0x12, 0x1F, 0x10,	//1
+	0x1D, 0x15, 0x17,	//2
+	0x11, 0x15, 0x1F,	//3
+	0x07, 0x04, 0x1F,	//4
+	0x17, 0x15, 0x1D,	//5
+	0x1F, 0x15, 0x1D,	//6
+	0x01, 0x19, 0x07,	//7
+	0x1F, 0x15, 0x1F,	//8
+	0x17, 0x15, 0x1F,	//9
+	0x00, 0x0A, 0x00,	//:
+	0x10, 0x0A, 0x00,	//;
+	0x04, 0x0A, 0x11,	//<
+	0x0A, 0x0A, 0x0A,	//=
+	0x11, 0x0A, 0x04,	//>
+	0x01, 0x15, 0x07,	//?
+	0x1F, 0x15, 0x17,	//@
+	0x1E, 0x05, 0x1E,	//A
+	0x1F, 0x15, 0x0A,	//B
+	0x0E, 0x11, 0x11,	//C
+	0x1F, 0x11, 0x0E,	//D
+	0x1F, 0x15, 0x11,	//E
+	0x1F, 0x05, 0x01,	//F
+	0x0E, 0x11, 0x1D,	//G
+	0x1F, 0x04, 0x1F,	//H
+	0x11, 0x1F, 0x11,	//I
+	0x08, 0x10, 0x0F,	//J
+	0x1F, 0x04, 0x1B,	//K
+	0x1F, 0x10, 0x10,	//L
+	0x1F, 0x06, 0x1F,	//M
+	0x1F, 0x01, 0x1E,	//N
+	0x0E, 0x11, 0x0E,	//O
+	0x1F, 0x05, 0x02,	//P
+	0x0E, 0x19, 0x16,	//Q
+	0x1F, 0x05, 0x1A,	//R
+	0x12, 0x15, 0x09,	//S
+	0x01, 0x1F, 0x01,	//T
+	0x1F, 0x10, 0x1F,	//U
+	0x0F, 0x10, 0x0F,	//V
+	0x1F, 0x0C, 0x1F,	//W
+	0x1B, 0x04, 0x1B,	//X
+	0x03, 0x1C, 0x03,	//Y
+	0x19, 0x15, 0x13,	//Z
+	0x1F, 0x11, 0x00,	//[
+	0x03, 0x04, 0x18,	//barra invertida
+	0x00, 0x11, 0x1F,	//]
+	0x02, 0x01, 0x02,	//^
+	0x10, 0x10, 0x10	//_
+};
+#else
+const int PixFuente[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00,	//espacio
+	0x00, 0x00, 0x5F, 0x00, 0x00,	//!
+	0x00, 0x07, 0x00, 0x07, 0x00,	//"
+	0x14, 0x7F, 0x14, 0x7F, 0x14,	//#
+	0x24, 0x2A, 0x7F, 0x2A, 0x12,	//$
+	0x23, 0x13, 0x08, 0x64, 0x62,	//%
+	0x36, 0x49, 0x55, 0x22, 0x50,	//&
+	0x00, 0x05, 0x03, 0x00, 0x00,	//'
+	0x00, 0x1C, 0x22, 0x41, 0x00,	//(
+	0x00, 0x41, 0x22, 0x1C, 0x00,	//)
+	0x08, 0x2A, 0x1C, 0x2A, 0x08,	//*
+	0x08, 0x08, 0x3E, 0x08, 0x08,	//+
+	0x00, 0x50, 0x30, 0x00, 0x00,	//,
+	0x08, 0x08, 0x08, 0x08, 0x08,	//-
+	0x00, 0x60, 0x60, 0x00, 0x00,	//.
+	0x20, 0x10, 0x08, 0x04, 0x02,	///
+	0x3E, 0x51, 0x49, 0x45, 0x3E,	//0
+	0x00, 0x42, 0x7F, 0x40, 0x00,	//1
+	0x42, 0x61, 0x51, 0x49, 0x46,	//2
+	0x21, 0x41, 0x45, 0x4B, 0x31,	//3
+	0x18, 0x14, 0x12, 0x7F, 0x10,	//4
+	0x27, 0x45, 0x45, 0x45, 0x39,	//5
+	0x3C, 0x4A, 0x49, 0x49, 0x30,	//6
+	0x01, 0x71, 0x09, 0x05, 0x03,	//7
+	0x36, 0x49, 0x49, 0x49, 0x36,	//8
+	0x06, 0x49, 0x49, 0x29, 0x1E,	//9
+	0x00, 0x36, 0x36, 0x00, 0x00,	//:
+	0x00, 0x56, 0x36, 0x00, 0x00,	//;
+	0x00, 0x08, 0x14, 0x22, 0x41,	//<
+	0x14, 0x14, 0x14, 0x14, 0x14,	//=
+	0x41, 0x22, 0x14, 0x08, 0x00,	//>
+	0x02, 0x01, 0x51, 0x09, 0x06,	//?
+	0x32, 0x49, 0x79, 0x41, 0x3E,	//@
+	0x7E, 0x11, 0x11, 0x11, 0x7E,	//A
+	0x7F, 0x49, 0x49, 0x49, 0x36,	//B
+	0x3E, 0x41, 0x41, 0x41, 0x22,	//C
+	0x7F, 0x41, 0x41, 0x22, 0x1C,	//D
+	0x7F, 0x49, 0x49, 0x49, 0x41,	//E
+	0x7F, 0x09, 0x09, 0x01, 0x01,	//F
+	0x3E, 0x41, 0x41, 0x51, 0x32,	//G
+	0x7F, 0x08, 0x08, 0x08, 0x7F,	//H
+	0x00, 0x41, 0x7F, 0x41, 0x00,	//I
+	0x20, 0x40, 0x41, 0x3F, 0x01,	//J
+	0x7F, 0x08, 0x14, 0x22, 0x41,	//K
+	0x7F, 0x40, 0x40, 0x40, 0x40,	//L
+	0x7F, 0x02, 0x04, 0x02, 0x7F,	//M
+	0x7F, 0x04, 0x08, 0x10, 0x7F,	//N
+	0x3E, 0x41, 0x41, 0x41, 0x3E,	//O
+	0x7F, 0x09, 0x09, 0x09, 0x06,	//P
+	0x3E, 0x41, 0x51, 0x21, 0x5E,	//Q
+	0x7F, 0x09, 0x19, 0x29, 0x46,	//R
+	0x46, 0x49, 0x49, 0x49, 0x31,	//S
+	0x01, 0x01, 0x7F, 0x01, 0x01,	//T
+	0x3F, 0x40, 0x40, 0x40, 0x3F,	//U
+	0x1F, 0x20, 0x40, 0x20, 0x1F,	//V
+	0x7F, 0x20, 0x18, 0x20, 0x7F,	//W
+	0x63, 0x14, 0x08, 0x14, 0x63,	//X
+	0x03, 0x04, 0x78, 0x04, 0x03,	//Y
+	0x61, 0x51, 0x49, 0x45, 0x43,	//Z
+	0x00, 0x00, 0x7F, 0x41, 0x41,	//[
+	0x02, 0x04, 0x08, 0x10, 0x20,	//barra invertida
+	0x41, 0x41, 0x7F, 0x00, 0x00,	//]
+	0x04, 0x02, 0x01, 0x02, 0x04,	//^
+	0x40, 0x40, 0x40, 0x40, 0x40,	//_
+	0x00, 0x01, 0x02, 0x04, 0x00,	//`
+	0x20, 0x54, 0x54, 0x54, 0x78,	//a
+	0x7F, 0x48, 0x44, 0x44, 0x38,	//b
+	0x38, 0x44, 0x44, 0x44, 0x20,	//c
+	0x38, 0x44, 0x44, 0x48, 0x7F,	//d
+	0x38, 0x54, 0x54, 0x54, 0x18,	//e
+	0x08, 0x7E, 0x09, 0x01, 0x02,	//f
+	0x08, 0x14, 0x54, 0x54, 0x3C,	//g
+	0x7F, 0x08, 0x04, 0x04, 0x78,	//h
+	0x00, 0x44, 0x7D, 0x40, 0x00,	//i
+	0x20, 0x40, 0x44, 0x3D, 0x00,	//j
+	0x00, 0x7F, 0x10, 0x28, 0x44,	//k
+	0x00, 0x41, 0x7F, 0x40, 0x00,	//l
+	0x7C, 0x04, 0x18, 0x04, 0x78,	//m
+	0x7C, 0x08, 0x04, 0x04, 0x78,	//n
+	0x38, 0x44, 0x44, 0x44, 0x38,	//o
+	0x7C, 0x14, 0x14, 0x14, 0x08,	//p
+	0x08, 0x14, 0x14, 0x18, 0x7C,	//q
+	0x7C, 0x08, 0x04, 0x04, 0x08,	//r
+	0x48, 0x54, 0x54, 0x54, 0x20,	//s
+	0x04, 0x3F, 0x44, 0x40, 0x20,	//t
+	0x3C, 0x40, 0x40, 0x20, 0x7C,	//u
+	0x1C, 0x20, 0x40, 0x20, 0x1C,	//v
+	0x3C, 0x40, 0x30, 0x40, 0x3C,	//w
+	0x44, 0x28, 0x10, 0x28, 0x44,	//x
+	0x0C, 0x50, 0x50, 0x50, 0x3C,	//y
+	0x44, 0x64, 0x54, 0x4C, 0x44,	//z
+	0x00, 0x08, 0x36, 0x41, 0x00,	//{
+	0x00, 0x00, 0x7F, 0x00, 0x00,	//|
+	0x00, 0x41, 0x36, 0x08, 0x00,	//}
+	0x10, 0x08, 0x08, 0x10, 0x08	//~
+};
+#endif
+
+/*
+ * Devuelve la columna (col) del caracter (c) como mascara de filas
+ * La columna PIX_FUENTE_ANCHO es la separacion entre letras y vale 0
+ */
+int PixColumnaLetra(char c, int col){
+	if(col >= PIX_FUENTE_ANCHO) return 0;
+
+#ifdef PIX_FUENTE_3X5
+	if((c >= 'a') && (c <= 'z')) c -= 'a' - 'A';	//la fuente pequeña no tiene minusculas
+#endif
+	if((c < PIX_FUENTE_PRIMERO) || (c > PIX_FUENTE_ULTIMO)) c = '?';
+
+	return PixFuente[_mul(c - PIX_FUENTE_PRIMERO, PIX_FUENTE_ANCHO) + col];
+}
+
+/*
+ * Dibuja una columna de letra (Bits) bajando desde (x, y) con el color ya
+ * preparado. Solo escribe los pixels encendidos; recorta por abajo
+ */
+void PixDibujarColumna(int x, int y, int Bits, int *Col){
+PixRecorrido r;
+int Filas;
+
+	if((x >= PIX_XY_ANCHO) || (y >= PIX_XY_ALTO) || (Bits == 0)) return;
+
+	Filas = PIX_XY_ALTO - y;
+	if(Filas > PIX_FUENTE_ALTO) Filas = PIX_FUENTE_ALTO;
+
+	PixRecorrer(&r, x, y, PIX_DIR_Y);
+	while(Filas--){
+		if(bit_test(Bits, 0)){
+			r.p[0] = Col[0];
+			r.p[1] = Col[1];
+			r.p[2] = Col[2];
+		}
+		Bits >>= 1;
+		PixAvanzar(&r);
+	}
+}
+
+/*
+ * Dibuja la cadena (str) con la esquina superior izquierda en (x, y)
+ */
+void DibujarTexto(signed long x, int y, char *str, int32 c){
+int Col[3];
+int i;
+
+	PixPrepararColor(c, Col);
+
+	while((*str != 0) && (x < PIX_XY_ANCHO)){
+		if(x > -(PIX_FUENTE_ANCHO + 1)){	//alguna columna de la letra cae dentro
+			for(i = 0; i < PIX_FUENTE_ANCHO; i++){
+				if(((x + i) >= 0) && ((x + i) < PIX_XY_ANCHO))
+					PixDibujarColumna(x + i, y, PixColumnaLetra(*str, i), Col);
+			}
+		}
+		x += PIX_FUENTE_ANCHO + 1;
+		str++;
+	}
+
+	PIX_BUFFER_TOCADO();
+}
+
+/*
+ * Prepara el scroll de (str) en las filas desde (y) con el color (c)
+ * El texto entra por la derecha en las siguientes llamadas a PasoScroll()
+ */
+void IniciarScroll(char *str, int y, int32 c){
+	ScrollTexto = str;
+	ScrollPos = 0;
+	ScrollCol = 0;
+	ScrollY = y;
+	ScrollVacias = 0;
+	PixPrepararColor(c, ScrollColor);
+}
+
+/*
+ * Mueve el texto una columna a la izquierda y dibuja solo la columna nueva
+ * Devuelve FALSE cuando el texto ha salido entero y vuelve a empezar
+ */
+short PasoScroll(void){
+int Bits = 0;
+int f, Filas;
+
+	if(ScrollY >= PIX_XY_ALTO) return FALSE;
+
+	//solo se mueven las filas que ocupa el texto
+	Filas = PIX_XY_ALTO - ScrollY;
+	if(Filas > PIX_FUENTE_ALTO) Filas = PIX_FUENTE_ALTO;
+	for(f = 0; f < Filas; f++){
+		PixDesplazarLinea(0, ScrollY + f, PIX_DIR_X, PIX_XY_ANCHO);
+	}
+	PIX_BUFFER_TOCADO();
+
+	if(ScrollTexto[ScrollPos] != 0){
+		Bits = PixColumnaLetra(ScrollTexto[ScrollPos], ScrollCol);
+		if(++ScrollCol > PIX_FUENTE_ANCHO){
+			ScrollCol = 0;
+			ScrollPos++;
+		}
+	}else if(++ScrollVacias >= PIX_XY_ANCHO){
+		//la ultima columna del texto acaba de salir por la izquierda
+		ScrollPos = 0;
+		ScrollCol = 0;
+		ScrollVacias = 0;
+		return FALSE;
+	}
+
+	PixDibujarColumna(PIX_XY_ANCHO - 1, ScrollY, Bits, ScrollColor);
+	return TRUE;
+}
@@ -0,0 +1,90 @@
+/*
+ * File:   led_pixels_texto.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Texto sobre la matriz (led_pixels_matriz.c) con una fuente en ROM.
+ *
+ * Por defecto la fuente es de 5x7 (ASCII 32-126, 475 bytes de ROM). Con
+ * PIX_FUENTE_3X5 se usa una de 3x5 (ASCII 32-95, 192 bytes) para matrices
+ * pequeñas; las minusculas se dibujan como mayusculas.
+ *
+ * La fuente esta guardada por columnas (bit 0 = fila de arriba), asi que cada
+ * columna de una letra es un byte y se dibuja bajando por la matriz con el
+ * recorrido de led_pixels_matriz.c, sin calcular el indice de cada pixel.
+ * Las letras se dibujan encima de lo que haya (el fondo no se toca).
+ *
+ * El scroll no vuelve a dibujar el texto en cada paso: mueve una columna a la
+ * izquierda las filas que ocupa el texto y dibuja solo la columna nueva del
+ * borde derecho. El dibujo cuesta lo que la altura de la letra, no lo que el
+ * texto entero.
+ *
+ * Las cadenas se pasan por puntero a RAM. Para pasar literales directamente
+ * ("HOLA") hay que usar #device PASS_STRINGS=IN_RAM en el programa.
+ * ----------------------------------------------------------------------------
+ *
+ * Uso:
+ * #include "led_pixels.c"
+ * #include "led_pixels_matriz.c"
+ * #include "led_pixels_texto.c"
+ *
+ * DibujarTexto(0, 0, "HOLA", PIX_ROJO);
+ *
+ * IniciarScroll(Mensaje, 0, PIX_AZUL);
+ * while(TRUE){
+ * 	PasoScroll();
+ * 	MostrarPixels();
+ * 	delay_ms(60);
+ * }
+ * ---------------------------------------------------------------------------*/
+
+/* --------------------------------- FUNCIONES --------------------------------
+ *
+ * -DibujarTexto(signed long x, int y, char *str, int32 c)
+ * Dibuja la cadena con la esquina superior izquierda en (x, y). (x) puede ser
+ * negativa o pasarse del ancho: lo que queda fuera no se dibuja
+ *
+ * -IniciarScroll(char *str, int y, int32 c)
+ * Prepara el scroll de la cadena en las filas desde (y). La cadena tiene que
+ * seguir existiendo mientras dure el scroll
+ *
+ * -PasoScroll()
+ * Avanza una columna. Devuelve FALSE cuando el texto ha salido del todo por la
+ * izquierda; la siguiente llamada empieza otra vez por el principio
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_TEXTO_H
+#define	LED_PIXELS_TEXTO_H
+
+#ifndef LED_PIXELS_MATRIZ_H
+	#error "Incluir led_pixels_matriz.c antes de led_pixels_texto.c"
+#endif
+
+#ifdef PIX_FUENTE_3X5
+	#define PIX_FUENTE_ANCHO	3
+	#define PIX_FUENTE_ALTO		5
+	#define PIX_FUENTE_ULTIMO	'_'		//ultimo caracter de la tabla
+#else
+	#define PIX_FUENTE_ANCHO	5
+	#define PIX_FUENTE_ALTO		7
+	#define PIX_FUENTE_ULTIMO	'~'
+#endif
+#define PIX_FUENTE_PRIMERO	' '
+
+/* VARIABLES */
+char *ScrollTexto;		//cadena del scroll
+int ScrollPos = 0;		//letra que se esta dibujando
+int ScrollCol = 0;		//columna de esa letra (PIX_FUENTE_ANCHO = separacion)
+int ScrollY = 0;		//primera fila del texto
+int ScrollColor[3];		//color ya escalado y ordenado
+int ScrollVacias = 0;	//columnas vacias desde el final del texto
+
+/* PROTOTIPOS */
+void DibujarTexto(signed long x, int y, char *str, int32 c);
+void IniciarScroll(char *str, int y, int32 c);
+short PasoScroll(void);
+
+#endif	/* LED_PIXELS_TEXTO_H */
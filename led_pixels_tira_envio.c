@@ -0,0 +1,45 @@
+/* 
+ * File:   led_pixels_tira_envio.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Funcion de envio de una salida de led_pixels_tiras.c. Es la misma para las
+ * 4 salidas: led_pixels_tiras.c la incluye una vez por cada salida definida
+ * con estas macros, que la parametrizan igual que a led_pixels_envio.c:
+ * PIX_ENV_TIRA	nombre de la funcion (PixEnviarTira1...)
+ * PIX_ENV_PIN		pin de datos
+ * PIX_ENV_PORT	direccion del puerto (bucles en ensamblador)
+ * PIX_ENV_BIT		bit del pin
+ * PIX_ENV_800		definida para 800KHz, sin definir para 400KHz
+ * 
+ * No puede ser un #define con parametros: dentro hay que incluir los bucles
+ * y elegir el de la frecuencia con #if. Al final deshace las macros para la
+ * siguiente salida.
+ * 
+ * FSR0 y el contador se cargan dentro, justo antes del bucle, para que nada
+ * los toque entre medias.
+ * ---------------------------------------------------------------------------*/
+
+void PIX_ENV_TIRA(int *Buffer, long Bytes){
+int i;
+	FSR0L = make8(Buffer, 0);
+	FSR0H = make8(Buffer, 1);
+#ifdef __PCH__
+	PRODL = make8(Bytes, 0);
+	PRODH = make8(Bytes + 255, 1);
+#else
+	i = Bytes;
+#endif
+	output_low(PIX_ENV_PIN);	//mueve el banco al del pin antes del bucle
+
+#include "led_pixels_envio.c"
+}
+
+#undef PIX_ENV_TIRA
+#undef PIX_ENV_PIN
+#undef PIX_ENV_PORT
+#undef PIX_ENV_BIT
+#undef PIX_ENV_800
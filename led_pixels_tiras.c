@@ -0,0 +1,226 @@
+#include <led_pixels_tiras.h>
+
+/*
+ * Bucles de envio de cada salida: la misma funcion (led_pixels_tira_envio.c)
+ * con el pin y la velocidad de PIX_TIRAn_*, una copia por salida definida
+ */
+#ifdef PIX_TIRA1_PIN
+	#define PIX_ENV_TIRA	PixEnviarTira1
+	#define PIX_ENV_PIN		PIX_TIRA1_PIN
+	#ifdef PIX_TIRA1_ASM_PORT
+		#define PIX_ENV_PORT	PIX_TIRA1_ASM_PORT
+		#define PIX_ENV_BIT		PIX_TIRA1_ASM_BIT
+	#endif
+	#ifndef PIX_TIRA1_400KHZ
+		#define PIX_ENV_800
+	#endif
+	#include "led_pixels_tira_envio.c"
+#endif
+
+#ifdef PIX_TIRA2_PIN
+	#define PIX_ENV_TIRA	PixEnviarTira2
+	#define PIX_ENV_PIN		PIX_TIRA2_PIN
+	#ifdef PIX_TIRA2_ASM_PORT
+		#define PIX_ENV_PORT	PIX_TIRA2_ASM_PORT
+		#define PIX_ENV_BIT		PIX_TIRA2_ASM_BIT
+	#endif
+	#ifndef PIX_TIRA2_400KHZ
+		#define PIX_ENV_800
+	#endif
+	#include "led_pixels_tira_envio.c"
+#endif
+
+#ifdef PIX_TIRA3_PIN
+	#define PIX_ENV_TIRA	PixEnviarTira3
+	#define PIX_ENV_PIN		PIX_TIRA3_PIN
+	#ifdef PIX_TIRA3_ASM_PORT
+		#define PIX_ENV_PORT	PIX_TIRA3_ASM_PORT
+		#define PIX_ENV_BIT		PIX_TIRA3_ASM_BIT
+	#endif
+	#ifndef PIX_TIRA3_400KHZ
+		#define PIX_ENV_800
+	#endif
+	#include "led_pixels_tira_envio.c"
+#endif
+
+#ifdef PIX_TIRA4_PIN
+	#define PIX_ENV_TIRA	PixEnviarTira4
+	#define PIX_ENV_PIN		PIX_TIRA4_PIN
+	#ifdef PIX_TIRA4_ASM_PORT
+		#define PIX_ENV_PORT	PIX_TIRA4_ASM_PORT
+		#define PIX_ENV_BIT		PIX_TIRA4_ASM_BIT
+	#endif
+	#ifndef PIX_TIRA4_400KHZ
+		#define PIX_ENV_800
+	#endif
+	#include "led_pixels_tira_envio.c"
+#endif
+
+/*
+ * Asocia un buffer y una salida a la tira y la deja en negro
+ * Parámetros: Buffer = NumLeds * 3 bytes, Salida = 1-4 (PIX_TIRAn_PIN)
+ */
+void InitTira(PixTira *t, int *Buffer, long NumLeds, int Salida){
+	if(NumLeds > PIX_TIRA_MAX_LEDS) NumLeds = PIX_TIRA_MAX_LEDS;
+	
+	t->Buffer = Buffer;
+	t->NumLeds = NumLeds;
+	t->Salida = Salida;
+	t->Brillo = 0;
+	t->RGB = FALSE;
+	
+	//el pin y el orden de color de cada salida son fijos
+	switch(Salida){
+#ifdef PIX_TIRA1_PIN
+		case 1:
+			output_low(PIX_TIRA1_PIN);
+	#ifdef PIX_TIRA1_RGB
+			t->RGB = TRUE;
+	#endif
+			break;
+#endif
+#ifdef PIX_TIRA2_PIN
+		case 2:
+			output_low(PIX_TIRA2_PIN);
+	#ifdef PIX_TIRA2_RGB
+			t->RGB = TRUE;
+	#endif
+			break;
+#endif
+#ifdef PIX_TIRA3_PIN
+		case 3:
+			output_low(PIX_TIRA3_PIN);
+	#ifdef PIX_TIRA3_RGB
+			t->RGB = TRUE;
+	#endif
+			break;
+#endif
+#ifdef PIX_TIRA4_PIN
+		case 4:
+			output_low(PIX_TIRA4_PIN);
+	#ifdef PIX_TIRA4_RGB
+			t->RGB = TRUE;
+	#endif
+			break;
+#endif
+	}
+	
+	LlenarTira(t, 0, NumLeds - 1, PIX_NEGRO);
+}
+
+/*
+ * Escribe el color RGB en el LED n de la tira
+ */
+void SetPixelColorTira(PixTira *t, long n, int r, int g, int b){
+	if(n < t->NumLeds){
+		if(t->Brillo != 0){
+			r = Escalar8(r, t->Brillo);
+			g = Escalar8(g, t->Brillo);
+			b = Escalar8(b, t->Brillo);
+		}
+		
+		int *p;
+		p = t->Buffer + n * 3;
+		
+		if(t->RGB){
+			*p++ = r;
+			*p++ = g;
+		}else{
+			*p++ = g;
+			*p++ = r;
+		}
+		*p = b;
+	}
+}
+
+/*
+ * Escribe el color en el LED n de la tira usando un int32 (formato RGB)
+ */
+void SetPixelColorTira(PixTira *t, long n, int32 c){
+	SetPixelColorTira(t, n, make8(c, 2), make8(c, 1), make8(c, 0));
+}
+
+/*
+ * Lee el color actual del LED n de la tira (formato int32 RGB)
+ */
+int32 GetPixelColorTira(PixTira *t, long n){
+	if(n < t->NumLeds){
+		int *p = t->Buffer + n * 3;
+		
+		if(t->RGB)
+			return make32(0, p[0], p[1], p[2]);
+		else
+			return make32(0, p[1], p[0], p[2]);
+	}
+	
+	return 0;
+}
+
+/*
+ * Rellena un rango de LEDs de la tira con un color
+ */
+void LlenarTira(PixTira *t, long from, long to, int32 c){
+long i;
+	
+	if(t->NumLeds == 0) return;
+	if(to >= t->NumLeds) to = t->NumLeds - 1;	//el bucle no termina con to = 65535
+	
+	for(i = from; i <= to; i++){
+		SetPixelColorTira(t, i, c);
+	}
+}
+
+/*
+ * Cambia el brillo de la tira sin cambiar su color, igual que CambiarBrillo()
+ */
+void CambiarBrilloTira(PixTira *t, int b){
+int NuevoBrillo = b + 1;
+	
+	if(NuevoBrillo != t->Brillo){
+		PixEscalarBuffer(t->Buffer, (long)t->NumLeds * 3, t->Brillo, NuevoBrillo);
+		t->Brillo = NuevoBrillo;
+	}
+}
+
+/*
+ * Envia la tira por su salida
+ * Deshabilita interrupciones durante la transmision y espera el reset de 50uS
+ */
+void MostrarTira(PixTira *t){
+short GIEval;		//Valor de GIE
+long Bytes = (long)t->NumLeds * 3;
+	
+	if(Bytes == 0) return;
+	
+	GIEval = GIE;	//Guardo valor de global interrupt enable
+	GIE = 0;		//Deshabilito interrupciones
+	
+#ifdef PIX_DELAY_TIMER2
+	//El Timer2 es comun a todas las tiras: 50uS desde el ultimo envio
+	while(TMR2IF == FALSE){delay_cycles(1);}
+#endif
+	
+	switch(t->Salida){
+#ifdef PIX_TIRA1_PIN
+		case 1: PixEnviarTira1(t->Buffer, Bytes); break;
+#endif
+#ifdef PIX_TIRA2_PIN
+		case 2: PixEnviarTira2(t->Buffer, Bytes); break;
+#endif
+#ifdef PIX_TIRA3_PIN
+		case 3: PixEnviarTira3(t->Buffer, Bytes); break;
+#endif
+#ifdef PIX_TIRA4_PIN
+		case 4: PixEnviarTira4(t->Buffer, Bytes); break;
+#endif
+	}
+	
+#ifdef PIX_DELAY_TIMER2
+	TMR2 = 0;			//Reinicio contador de Timer2
+	TMR2IF = FALSE;		//Quito flag de interrupcion
+#else
+	delay_us(50);		//espero 50uS para volver a enviar
+#endif
+	
+	GIE = GIEval;		//restauro valor de GIE
+}
@@ -0,0 +1,115 @@
+/*
+ * File:   led_pixels_tiras.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Varias tiras independientes, cada una con su buffer, numero de LEDs, pin,
+ * velocidad (400/800KHz), orden de color y brillo.
+ *
+ * El pin y la velocidad tienen que ser constantes en los bucles de envio
+ * (BSF/BCF sobre un puerto y bit fijos), asi que se declaran en tiempo de
+ * compilacion como "salidas" 1 a 4. Para cada salida definida se compila una
+ * copia de los bucles de led_pixels_envio.c con su pin. Cada tira (PixTira)
+ * guarda su buffer, su longitud y la salida por la que se envia, y
+ * MostrarTira() salta directamente al bucle de esa salida. La funcion de envio
+ * es una sola (led_pixels_tira_envio.c), incluida una vez por salida.
+ *
+ * La tira principal (Pixels[], SetPixelColor()...) no cambia y no paga nada
+ * por este modulo. Las funciones de las tiras son las mismas con "Tira" y un
+ * puntero a la tira como primer parametro.
+ *
+ * Solo para tiras WS281x por un pin (no con PIX_APA102 ni PIX_DMA). En PIC16
+ * cada tira puede tener como mucho 85 LEDs (contador de bytes de 8 bits).
+ * ----------------------------------------------------------------------------
+ *
+ * Uso:
+ * #define PIX_TIRA1_PIN		PIN_A1
+ * #define PIX_TIRA1_400KHZ				//WS2811 (sin definir: 800KHz)
+ * #define PIX_TIRA1_RGB				//orden RGB (sin definir: GRB)
+ * #define PIX_TIRA2_PIN		PIN_A2
+ * #define PIX_TIRA2_ASM_PORT	0x10C		//solo con bucles en ensamblador
+ * #define PIX_TIRA2_ASM_BIT	2			//(20, 40, 48, 64MHz y PIC18)
+ * #include "led_pixels.c"
+ * #include "led_pixels_tiras.c"
+ *
+ * int BufGuirnalda[50 * 3];
+ * PixTira Guirnalda;
+ *
+ * InitTira(&Guirnalda, BufGuirnalda, 50, 1);	//50 LEDs por la salida 1
+ * SetPixelColorTira(&Guirnalda, 0, PIX_ROJO);
+ * MostrarTira(&Guirnalda);
+ * ---------------------------------------------------------------------------*/
+
+/* --------------------------------- FUNCIONES --------------------------------
+ *
+ * -InitTira(PixTira *t, int *Buffer, long NumLeds, int Salida)
+ * Asocia el buffer (3 bytes por LED) y la salida 1-4 a la tira y la apaga.
+ * Las longitudes e indices de las tiras son long, no PixIndice: cada tira
+ * puede ser mas larga que la principal (hasta PIX_TIRA_MAX_LEDS)
+ *
+ * -SetPixelColorTira(PixTira *t, long n, int r, int g, int b)
+ * -SetPixelColorTira(PixTira *t, long n, int32 c)
+ * -GetPixelColorTira(PixTira *t, long n)
+ * -LlenarTira(PixTira *t, long from, long to, int32 c)
+ * -CambiarBrilloTira(PixTira *t, int b)
+ * Igual que las funciones de la tira principal
+ *
+ * -MostrarTira(PixTira *t)
+ * Envia la tira por su salida. Igual que MostrarPixels() desactiva las
+ * interrupciones durante el envio y espera los 50uS de reset
+ * ---------------------------------------------------------------------------*/
+
+#ifndef LED_PIXELS_TIRAS_H
+#define	LED_PIXELS_TIRAS_H
+
+#if defined(PIX_APA102) || defined(PIX_DMA)
+	#error "led_pixels_tiras.c solo funciona con tiras WS281x por un pin"
+#endif
+
+//Bucles en ensamblador: cada salida necesita su puerto y bit
+#if (getenv("CLOCK") == 48000000) || defined(PIX_RELOJ_GENERADO) || defined(__PCH__)
+	#if (defined(PIX_TIRA1_PIN) && !defined(PIX_TIRA1_ASM_PORT)) || (defined(PIX_TIRA2_PIN) && !defined(PIX_TIRA2_ASM_PORT)) || (defined(PIX_TIRA3_PIN) && !defined(PIX_TIRA3_ASM_PORT)) || (defined(PIX_TIRA4_PIN) && !defined(PIX_TIRA4_ASM_PORT))
+		#error "A esta frecuencia cada salida necesita PIX_TIRAn_ASM_PORT y PIX_TIRAn_ASM_BIT"
+	#endif
+#endif
+
+//A 16MHz y 24MHz solo hay bucles de 400KHz
+#if (getenv("CLOCK") == 24000000) || (getenv("CLOCK") == 16000000)
+	#if (defined(PIX_TIRA1_PIN) && !defined(PIX_TIRA1_400KHZ)) || (defined(PIX_TIRA2_PIN) && !defined(PIX_TIRA2_400KHZ)) || (defined(PIX_TIRA3_PIN) && !defined(PIX_TIRA3_400KHZ)) || (defined(PIX_TIRA4_PIN) && !defined(PIX_TIRA4_400KHZ))
+		#error "A 16MHz y 24MHz todas las salidas tienen que ser PIX_TIRAn_400KHZ"
+	#endif
+#endif
+
+#if !defined(PIX_TIRA1_PIN) && !defined(PIX_TIRA2_PIN) && !defined(PIX_TIRA3_PIN) && !defined(PIX_TIRA4_PIN)
+	#error "Define al menos una salida: PIX_TIRA1_PIN ... PIX_TIRA4_PIN"
+#endif
+
+//Maximo de LEDs por tira: el contador de bytes de los bucles de PIC16 es un INT
+#ifdef __PCH__
+	#define PIX_TIRA_MAX_LEDS	21845
+#else
+	#define PIX_TIRA_MAX_LEDS	85
+#endif
+
+/* TIPOS */
+typedef struct{
+	int *Buffer;		//3 bytes por LED, reservado por el programa
+	long NumLeds;		//LEDs de la tira (hasta PIX_TIRA_MAX_LEDS)
+	int Salida;			//1-4: pin, puerto/bit y velocidad de PIX_TIRAn_*
+	int Brillo;			//mismo formato que Brillo (0 = sin escalar)
+	short RGB;			//TRUE: orden RGB, FALSE: GRB
+}PixTira;
+
+/* PROTOTIPOS */
+void InitTira(PixTira *t, int *Buffer, long NumLeds, int Salida);
+void SetPixelColorTira(PixTira *t, long n, int r, int g, int b);
+void SetPixelColorTira(PixTira *t, long n, int32 c);
+int32 GetPixelColorTira(PixTira *t, long n);
+void LlenarTira(PixTira *t, long from, long to, int32 c);
+void CambiarBrilloTira(PixTira *t, int b);
+void MostrarTira(PixTira *t);
+
+#endif	/* LED_PIXELS_TIRAS_H */
@@ -0,0 +1,173 @@
+/*
+ * File:   pix_apa102.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Prueba en el PC de la trama APA102/SK9822 que envia MostrarPixels()
+ *
+ * Programa para el PC (no para el PIC). Compila el mismo envio que el PIC
+ * (led_pixels_apa102.c, con el formato de led_pixels_apa102.h) con un
+ * spi_write() que guarda los bytes, llena el buffer como SetPixelColor() con
+ * PIX_BGR y el brillo como CambiarBrillo() (5 bits de arriba), y comprueba
+ * para cada longitud de tira de 1 a N LEDs:
+ *
+ * -Trama de inicio: 4 bytes a 0
+ * -Cabecera de cada LED: 0xE0 | brillo, con los 3 bits de arriba a 1
+ * -Colores en orden B, G, R
+ * -Trama de fin: bytes a 0, al menos 32 bits (reset del SK9822) mas medio bit
+ *  por LED, y la longitud total 4 + 4 * LEDs + fin
+ *
+ * El brillo va cambiando con la longitud para pasar por los 256 valores. Si
+ * algo falla escribe la primera diferencia de cada longitud y devuelve 1.
+ *
+ * Compilar:	gcc -O2 -o pix_apa102 pix_apa102.c
+ *
+ * Uso:
+ * pix_apa102
+ * pix_apa102 -n 4000
+ *
+ * Opciones:
+ * -n N			LEDs de la tira mas larga a probar (por defecto 1024, como
+ *				mucho 4016: la trama de fin se cuenta en 8 bits)
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../led_pixels_apa102.h"
+
+//Lo que en el PIC viene de led_pixels.h: la tira tiene NumLeds LEDs
+typedef unsigned PixIndice;
+static unsigned NumLeds;
+#define PIX_NUM_LEDS		NumLeds
+#define PIX_APA102_FIN		PIX_APA102_FIN_N(NumLeds)
+
+static int *Pixels;
+static int PixBrillo5 = 31;
+
+//Bytes que salen por el SPI
+static uint8_t *Trama;
+static size_t TramaLen;
+
+static void spi_write(int b){
+	Trama[TramaLen++] = (uint8_t)b;
+}
+
+/*
+ * El envio de MostrarPixels() con PIX_APA102
+ */
+static void Enviar(void){
+	uint8_t i;	//int de CCS
+#include "../led_pixels_apa102.c"
+}
+
+/*
+ * SetPixelColor() con PIX_BGR, sin brillo (lo lleva la cabecera)
+ */
+static void SetPixelColor(unsigned n, int r, int g, int b){
+	int *p = &Pixels[n * 3];
+	p[0] = b;
+	p[1] = g;
+	p[2] = r;
+}
+
+static int Rojo(unsigned n){ return (n * 7 + 1) & 0xFF; }
+static int Verde(unsigned n){ return (n * 13 + 2) & 0xFF; }
+static int Azul(unsigned n){ return (n * 29 + 3) & 0xFF; }
+
+/*
+ * Comprueba la trama de una tira de NumLeds LEDs. Devuelve 0 si hay error
+ */
+static int Comprobar(int Brillo){
+	size_t Fin = TramaLen - PIX_APA102_INICIO - 4 * (size_t)NumLeds;
+	size_t k;
+	unsigned n;
+	int Cab = 0xE0 | (Brillo >> 3);
+
+	if(TramaLen < PIX_APA102_INICIO + 4 * (size_t)NumLeds){
+		printf("%u LEDs: trama de %zu bytes, corta\n", NumLeds, TramaLen);
+		return 0;
+	}
+	for(k = 0; k < PIX_APA102_INICIO; k++){
+		if(Trama[k] != 0){
+			printf("%u LEDs: byte %zu de la trama de inicio = 0x%02X\n", NumLeds, k, Trama[k]);
+			return 0;
+		}
+	}
+	for(n = 0; n < NumLeds; n++){
+		const uint8_t *p = &Trama[PIX_APA102_INICIO + 4 * n];
+		if(p[0] != Cab || (p[0] & 0xE0) != 0xE0){
+			printf("%u LEDs: cabecera del LED %u = 0x%02X, tiene que ser 0x%02X\n", NumLeds, n, p[0], Cab);
+			return 0;
+		}
+		if(p[1] != Azul(n) || p[2] != Verde(n) || p[3] != Rojo(n)){
+			printf("%u LEDs: LED %u = %02X %02X %02X, tiene que ser B G R = %02X %02X %02X\n",
+				NumLeds, n, p[1], p[2], p[3], Azul(n), Verde(n), Rojo(n));
+			return 0;
+		}
+	}
+	if(Fin * 8 < 32 + (NumLeds + 1) / 2){
+		printf("%u LEDs: trama de fin de %zu bytes, hacen falta %u bits\n", NumLeds, Fin, 32 + (NumLeds + 1) / 2);
+		return 0;
+	}
+	if(Fin != (size_t)PIX_APA102_FIN){
+		printf("%u LEDs: trama de fin de %zu bytes, tiene que ser %u\n", NumLeds, Fin, (unsigned)PIX_APA102_FIN);
+		return 0;
+	}
+	for(k = TramaLen - Fin; k < TramaLen; k++){
+		if(Trama[k] != 0){
+			printf("%u LEDs: byte %zu de la trama de fin = 0x%02X\n", NumLeds, k, Trama[k]);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static void Ayuda(void){
+	fprintf(stderr, "Uso: pix_apa102 [-n LEDs]\n");
+}
+
+int main(int argc, char *argv[]){
+	unsigned Max = 1024, n;
+	int i, Fallos = 0;
+
+	for(i = 1; i < argc; i++){
+		if(strcmp(argv[i], "-n") == 0 && i + 1 < argc) Max = (unsigned)atoi(argv[++i]);
+		else{ Ayuda(); return 2; }
+	}
+	if(Max < 1){ Ayuda(); return 2; }
+	if(PIX_APA102_FIN_N(Max) > 255){
+		//el contador de la trama de fin es de 8 bits; led_pixels.h no compila
+		fprintf(stderr, "Con %u LEDs la trama de fin no cabe en el contador de 8 bits\n", Max);
+		return 2;
+	}
+
+	Pixels = malloc(sizeof(int) * 3 * Max);
+	Trama = malloc(PIX_APA102_INICIO + 4 * (size_t)Max + PIX_APA102_FIN_N(Max) + 64);
+	if(Pixels == NULL || Trama == NULL){
+		fprintf(stderr, "Sin memoria\n");
+		return 1;
+	}
+
+	for(NumLeds = 1; NumLeds <= Max; NumLeds++){
+		int Brillo = (NumLeds * 37) & 0xFF;
+
+		for(n = 0; n < NumLeds; n++) SetPixelColor(n, Rojo(n), Verde(n), Azul(n));
+		PixBrillo5 = Brillo >> 3;		//CambiarBrillo() con PIX_APA102
+
+		TramaLen = 0;
+		Enviar();
+		if(!Comprobar(Brillo)) Fallos++;
+	}
+
+	printf("Tiras de 1 a %u LEDs: %d con error\n", Max, Fallos);
+
+	free(Pixels);
+	free(Trama);
+	return Fallos ? 1 : 0;
+}
@@ -0,0 +1,245 @@
+/*
+ * File:   pix_audio.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Banco de pruebas en el PC del analisis de audio de led_pixels_audio.c
+ *
+ * Compila el mismo led_pixels_goertzel.c que usa el PIC y le pasa un archivo
+ * WAV (PCM de 8 o 16 bits, se usa el primer canal) remuestreado a la
+ * frecuencia del PIC cogiendo la muestra mas cercana, igual que haria el ADC
+ * sin filtro. Por cada bloque escribe una linea CSV:
+ *
+ * bloque,ms,volumen,banda1,...,golpe
+ *
+ * Con -t no lee archivos: genera un tono en cada banda y comprueba que esa
+ * banda es la que mas energia tiene, con al menos 16 (6dB) de diferencia. Si
+ * algo falla devuelve 1.
+ *
+ * Compilar:	gcc -O2 -o pix_audio pix_audio.c -lm
+ *
+ * Uso:
+ * pix_audio -f cancion.wav
+ * pix_audio -f cancion.wav -r 8000 -n 64 -b 125,500,1000,2500
+ * pix_audio -t
+ *
+ * Opciones:
+ * -f archivo	WAV a analizar
+ * -r Hz		frecuencia de muestreo del PIC (PIX_AUDIO_HZ, por defecto 8000)
+ * -n N			muestras por bloque (PIX_AUDIO_N, por defecto 64)
+ * -b f1,f2..	frecuencias de las bandas (PIX_AUDIO_BANDAn, hasta 4)
+ * -u umbral	PIX_AUDIO_UMBRAL para la deteccion de golpes (por defecto 16)
+ * -t			prueba con tonos sinteticos
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+//Tipos que en el PIC define led_pixels_audio.h
+typedef uint8_t PixU8;
+typedef int8_t PixS8;
+typedef int16_t PixS16;
+typedef uint32_t PixU32;
+typedef int32_t PixS32;
+
+#include "../led_pixels_goertzel.c"
+
+#define MAX_BANDAS	4
+
+static int Bandas = 4;
+static PixU32 Frec[MAX_BANDAS] = {125, 500, 1000, 2500};
+static PixS16 Coef[MAX_BANDAS];
+static int Umbral = 16;
+
+typedef struct{
+	int Canales, Bits;
+	PixU32 Hz;
+	long Muestras;		//por canal
+	unsigned char *Datos;
+}Wav;
+
+static PixU32 Le32(const unsigned char *p){
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((PixU32)p[3] << 24);
+}
+
+static int Le16(const unsigned char *p){
+	return p[0] | (p[1] << 8);
+}
+
+/*
+ * Lee un WAV PCM de 8 o 16 bits. Devuelve 0 si no se puede usar
+ */
+static int LeerWav(const char *Nombre, Wav *w){
+	FILE *f = fopen(Nombre, "rb");
+	unsigned char cab[12], ch[8];
+	int Formato = 0;
+
+	memset(w, 0, sizeof(*w));
+	if(f == NULL) return 0;
+	if(fread(cab, 1, 12, f) != 12 || memcmp(cab, "RIFF", 4) || memcmp(cab + 8, "WAVE", 4)){
+		fclose(f);
+		return 0;
+	}
+
+	while(fread(ch, 1, 8, f) == 8){
+		PixU32 Largo = Le32(ch + 4);
+		if(memcmp(ch, "fmt ", 4) == 0){
+			unsigned char fmt[16];
+			if(Largo < 16 || fread(fmt, 1, 16, f) != 16) break;
+			Formato = Le16(fmt);
+			w->Canales = Le16(fmt + 2);
+			w->Hz = Le32(fmt + 4);
+			w->Bits = Le16(fmt + 14);
+			fseek(f, (Largo - 16 + 1) & ~1UL, SEEK_CUR);
+		}else if(memcmp(ch, "data", 4) == 0){
+			w->Datos = malloc(Largo);
+			if(w->Datos == NULL || fread(w->Datos, 1, Largo, f) != Largo) break;
+			if(w->Canales > 0 && w->Bits > 0) w->Muestras = Largo / (w->Canales * (w->Bits / 8));
+			break;
+		}else{
+			fseek(f, (Largo + 1) & ~1UL, SEEK_CUR);
+		}
+	}
+	fclose(f);
+
+	if(Formato != 1 || (w->Bits != 8 && w->Bits != 16) || w->Muestras == 0){
+		free(w->Datos);
+		return 0;
+	}
+	return 1;
+}
+
+/*
+ * Muestra i del primer canal convertida a lo que guarda el PIC (-128..127)
+ */
+static PixS8 MuestraWav(const Wav *w, long i){
+	const unsigned char *p = w->Datos + i * w->Canales * (w->Bits / 8);
+
+	if(w->Bits == 8) return (PixS8)(p[0] ^ 0x80);
+	return (PixS8)(((int16_t)Le16(p)) >> 8);
+}
+
+static void Ayuda(void){
+	printf("Uso: pix_audio -f archivo.wav [-r Hz] [-n N] [-b f1,f2,...] [-u umbral]\n");
+	printf("     pix_audio -t [-r Hz] [-n N] [-b f1,f2,...]\n");
+}
+
+/*
+ * Tono en cada banda: esa banda tiene que ganar a las demas por 16 o mas
+ */
+static int Prueba(PixU32 Hz, int N){
+	PixS8 x[128];
+	PixU8 Niv[MAX_BANDAS], Vol;
+	int b, k, n, Fallos = 0;
+
+	for(b = 0; b < Bandas; b++){
+		int Peor = 255;
+
+		for(n = 0; n < N; n++) x[n] = (PixS8)lround(100 * sin(2 * M_PI * Frec[b] * n / Hz));
+		PixAudioAnalizar(x, N, Coef, Bandas, Niv, &Vol);
+
+		for(k = 0; k < Bandas; k++)
+			if(k != b && Niv[b] - Niv[k] < Peor) Peor = Niv[b] - Niv[k];
+
+		printf("tono %5u Hz: vol %3u niveles", Frec[b], Vol);
+		for(k = 0; k < Bandas; k++) printf(" %3u", Niv[k]);
+		if(Bandas > 1 && Peor < 16){
+			printf("  FALLO (margen %d)\n", Peor);
+			Fallos++;
+		}else{
+			printf("  ok\n");
+		}
+	}
+
+	//silencio: todo a 0
+	memset(x, 0, sizeof(x));
+	PixAudioAnalizar(x, N, Coef, Bandas, Niv, &Vol);
+	for(k = 0; k < Bandas; k++) if(Niv[k] != 0) Fallos++;
+	if(Vol != 0) Fallos++;
+	printf("silencio: %s\n", Fallos ? "revisar" : "ok");
+
+	return Fallos;
+}
+
+int main(int argc, char **argv){
+	const char *Archivo = NULL;
+	PixU32 Hz = 8000;
+	int N = 64, Test = 0, i;
+
+	for(i = 1; i < argc; i++){
+		const char *op = argv[i];
+		const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if(strcmp(op, "-t") == 0){ Test = 1; continue; }
+		if(v == NULL){ Ayuda(); return 2; }
+		i++;
+
+		if(strcmp(op, "-f") == 0) Archivo = v;
+		else if(strcmp(op, "-r") == 0) Hz = strtoul(v, NULL, 10);
+		else if(strcmp(op, "-n") == 0) N = atoi(v);
+		else if(strcmp(op, "-u") == 0) Umbral = atoi(v);
+		else if(strcmp(op, "-b") == 0){
+			char *p = (char *)v;
+			for(Bandas = 0; Bandas < MAX_BANDAS && *p; Bandas++){
+				Frec[Bandas] = strtoul(p, &p, 10);
+				if(*p == ',') p++;
+			}
+		}else{
+			Ayuda();
+			return 2;
+		}
+	}
+
+	if(Hz == 0 || N < 8 || N > 128 || Bandas < 1 || (!Test && Archivo == NULL)){
+		Ayuda();
+		return 2;
+	}
+	for(i = 0; i < Bandas; i++) Coef[i] = PixAudioCoef(Frec[i], Hz);
+
+	if(Test) return Prueba(Hz, N) ? 1 : 0;
+
+	{
+		Wav w;
+		PixS8 x[128];
+		PixU8 Niv[MAX_BANDAS], Vol, Media = 0;
+		long Bloque = 0, Total;
+		int n, k;
+
+		if(!LeerWav(Archivo, &w)){
+			fprintf(stderr, "No se puede leer %s (WAV PCM de 8 o 16 bits)\n", Archivo);
+			return 1;
+		}
+
+		Total = (long)((double)w.Muestras * Hz / w.Hz);
+		printf("bloque,ms,volumen");
+		for(k = 0; k < Bandas; k++) printf(",banda%d", k + 1);
+		printf(",golpe\n");
+
+		for(Bloque = 0; (Bloque + 1) * N <= Total; Bloque++){
+			int Golpe;
+
+			for(n = 0; n < N; n++){
+				long j = (long)((double)(Bloque * N + n) * w.Hz / Hz);
+				x[n] = MuestraWav(&w, j);
+			}
+			PixAudioAnalizar(x, N, Coef, Bandas, Niv, &Vol);
+
+			//la misma deteccion de golpes que AnalizarAudio()
+			Golpe = (Niv[0] > Media) && (Niv[0] - Media >= Umbral);
+			Media = (PixU8)(((unsigned)Media * 7 + Niv[0]) >> 3);
+
+			printf("%ld,%.1f,%u", Bloque, 1000.0 * Bloque * N / Hz, Vol);
+			for(k = 0; k < Bandas; k++) printf(",%u", Niv[k]);
+			printf(",%d\n", Golpe);
+		}
+		free(w.Datos);
+	}
+
+	return 0;
+}
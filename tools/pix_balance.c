@@ -0,0 +1,199 @@
+/*
+ * File:   pix_balance.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Calculo de los factores de balance de blancos para PIX_LUT
+ *
+ * Programa para el PC (no para el PIC). A partir de la cromaticidad (x, y) y
+ * la luminancia (Y) de cada canal encendido a 255, medidas con un colorimetro
+ * sobre un LED del lote, calcula cuanto hay que bajar cada canal para que el
+ * blanco (255, 255, 255) tenga la cromaticidad pedida: una temperatura de
+ * color (-k) o un punto (x, y) (-w). El canal que limita queda a 255.
+ *
+ * Por defecto escribe los #define PIX_BALANCE_R/G/B. Opcionalmente escribe
+ * la linea #rom para cargar los factores en la EEPROM (PIX_LUT_EEPROM) y la
+ * tabla PixCurva[] de una gamma (PIX_LUT_CURVA).
+ *
+ * Compilar:	gcc -O2 -o pix_balance pix_balance.c -lm
+ *
+ * Uso:
+ * pix_balance -r 0.690,0.305,2.1 -g 0.165,0.720,6.8 -b 0.135,0.050,1.0
+ * pix_balance -r ... -g ... -b ... -k 4000 -y 2.2
+ * pix_balance -r ... -g ... -b ... -w 0.3127,0.3290 -e 0
+ *
+ * Opciones:
+ * -r x,y,Y		cromaticidad y luminancia del rojo a 255
+ * -g x,y,Y		idem verde
+ * -b x,y,Y		idem azul (Y en cualquier unidad, la misma en los tres)
+ * -k K			blanco objetivo por temperatura de color (por defecto 6500)
+ * -w x,y		blanco objetivo por cromaticidad
+ * -y gamma		genera tambien const int PixCurva[256] (v^gamma)
+ * -e dir		genera tambien la linea #rom de la EEPROM en la direccion dir
+ *
+ * La temperatura se pasa a (x, y) con la aproximacion cubica del locus de
+ * Planck de Kim et al. (1667K a 25000K). D65 no esta sobre el locus: para
+ * el blanco de sRGB usar -w 0.3127,0.3290 en lugar de -k 6500.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef struct{
+	double x, y, Y;
+}Medida;
+
+/*
+ * Cromaticidad del cuerpo negro a la temperatura T (Kelvin)
+ */
+static int Planck(double T, double *x, double *y){
+	double t = 1e3 / T;
+
+	if(T < 1667 || T > 25000) return 0;
+
+	if(T <= 4000) *x = -0.2661239 * t * t * t - 0.2343589 * t * t + 0.8776956 * t + 0.179910;
+	else *x = -3.0258469 * t * t * t + 2.1070379 * t * t + 0.2226347 * t + 0.240390;
+
+	if(T <= 2222) *y = -1.1063814 * *x * *x * *x - 1.34811020 * *x * *x + 2.18555832 * *x - 0.20219683;
+	else if(T <= 4000) *y = -0.9549476 * *x * *x * *x - 1.37418593 * *x * *x + 2.09137015 * *x - 0.16748867;
+	else *y = 3.0817580 * *x * *x * *x - 5.87338670 * *x * *x + 3.75112997 * *x - 0.37001483;
+
+	return 1;
+}
+
+/*
+ * Pasa (x, y, Y) a XYZ
+ */
+static void XYZ(const Medida *m, double *v){
+	v[0] = m->x * m->Y / m->y;
+	v[1] = m->Y;
+	v[2] = (1 - m->x - m->y) * m->Y / m->y;
+}
+
+static double Det3(double m[3][3]){
+	return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+		 - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+		 + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+}
+
+/*
+ * Resuelve M * s = w por Cramer. Las columnas de M son los XYZ de cada canal
+ */
+static int Resolver(double M[3][3], const double *w, double *s){
+	double d = Det3(M), A[3][3];
+	int c, f, k;
+
+	if(fabs(d) < 1e-12) return 0;
+	for(c = 0; c < 3; c++){
+		memcpy(A, M, sizeof(A));
+		for(f = 0; f < 3; f++) A[f][c] = w[f];
+		s[c] = Det3(A) / d;
+	}
+	for(k = 0; k < 3; k++) if(s[k] <= 0) return 0;
+	return 1;
+}
+
+static int Leer(const char *v, Medida *m){
+	return sscanf(v, "%lf,%lf,%lf", &m->x, &m->y, &m->Y) == 3 && m->y > 0 && m->Y > 0;
+}
+
+static void Ayuda(void){
+	printf("Uso: pix_balance -r x,y,Y -g x,y,Y -b x,y,Y [-k K | -w x,y] [-y gamma] [-e dir]\n");
+}
+
+int main(int argc, char **argv){
+	Medida Canal[3];
+	double M[3][3], w[3], s[3], Max, xw = 0, yw = 0, Kelvin = 6500, Gamma = 0;
+	int Factor[3], Leidos = 0, PorPunto = 0, Eeprom = -1, i, c;
+	const char *Nombre[3] = {"R", "G", "B"};
+
+	for(i = 1; i < argc; i++){
+		const char *op = argv[i];
+		const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if(v == NULL){ Ayuda(); return 2; }
+		i++;
+
+		if(strcmp(op, "-r") == 0){ if(!Leer(v, &Canal[0])){ Ayuda(); return 2; } Leidos |= 1; }
+		else if(strcmp(op, "-g") == 0){ if(!Leer(v, &Canal[1])){ Ayuda(); return 2; } Leidos |= 2; }
+		else if(strcmp(op, "-b") == 0){ if(!Leer(v, &Canal[2])){ Ayuda(); return 2; } Leidos |= 4; }
+		else if(strcmp(op, "-k") == 0) Kelvin = atof(v);
+		else if(strcmp(op, "-y") == 0) Gamma = atof(v);
+		else if(strcmp(op, "-e") == 0) Eeprom = atoi(v);
+		else if(strcmp(op, "-w") == 0){
+			if(sscanf(v, "%lf,%lf", &xw, &yw) != 2 || yw <= 0){ Ayuda(); return 2; }
+			PorPunto = 1;
+		}else{
+			Ayuda();
+			return 2;
+		}
+	}
+
+	if(Leidos != 7){
+		Ayuda();
+		return 2;
+	}
+	if(!PorPunto && !Planck(Kelvin, &xw, &yw)){
+		fprintf(stderr, "La temperatura tiene que estar entre 1667K y 25000K\n");
+		return 2;
+	}
+
+	//Columnas: XYZ de cada canal a 255
+	for(c = 0; c < 3; c++){
+		double v3[3];
+		XYZ(&Canal[c], v3);
+		for(i = 0; i < 3; i++) M[i][c] = v3[i];
+	}
+
+	//Blanco objetivo con Y = 1 (la escala da igual, se normaliza despues)
+	w[0] = xw / yw;
+	w[1] = 1;
+	w[2] = (1 - xw - yw) / yw;
+
+	if(!Resolver(M, w, s)){
+		fprintf(stderr, "Ese blanco no se puede conseguir con estos tres canales\n");
+		return 1;
+	}
+
+	Max = s[0];
+	for(c = 1; c < 3; c++) if(s[c] > Max) Max = s[c];
+	for(c = 0; c < 3; c++) Factor[c] = (int)floor(255 * s[c] / Max + 0.5);
+
+	//Informe: blanco que saldra realmente con los factores redondeados
+	{
+		double X = 0, Y = 0, Z = 0, Suma;
+		for(c = 0; c < 3; c++){
+			X += M[0][c] * Factor[c] / 255;
+			Y += M[1][c] * Factor[c] / 255;
+			Z += M[2][c] * Factor[c] / 255;
+		}
+		Suma = X + Y + Z;
+		printf("/*\n");
+		printf(" * Blanco objetivo: x=%.4f y=%.4f", xw, yw);
+		if(!PorPunto) printf(" (%.0fK)", Kelvin);
+		printf("\n * Blanco con los factores: x=%.4f y=%.4f, luminancia %.1f%% de la de 255,255,255\n",
+			X / Suma, Y / Suma, 100 * Y / (M[1][0] + M[1][1] + M[1][2]));
+		printf(" */\n");
+	}
+
+	for(c = 0; c < 3; c++) printf("#define PIX_BALANCE_%s\t%d\n", Nombre[c], Factor[c]);
+
+	if(Eeprom >= 0)
+		printf("#rom int8 getenv(\"EEPROM_ADDRESS\") + %d = {%d, %d, %d}\n", Eeprom, Factor[0], Factor[1], Factor[2]);
+
+	if(Gamma > 0){
+		printf("#define PIX_LUT_CURVA\n");
+		printf("const int PixCurva[256] = {");
+		for(i = 0; i < 256; i++){
+			printf("%s%3d", (i == 0) ? "\n\t" : ((i % 16) == 0) ? ",\n\t" : ", ", (int)floor(255 * pow(i / 255.0, Gamma) + 0.5));
+		}
+		printf("\n};\n");
+	}
+
+	return 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * File:   pix_brillo.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Prueba exhaustiva en el PC de CambiarBrillo() y la tabla PixInverso[]
+ *
+ * Programa para el PC (no para el PIC). Lee PixInverso[] de led_pixels.c
+ * (la misma tabla que compila el PIC, no una copia) y comprueba:
+ *
+ * -Cada entrada: PixInverso[0] = 256 y PixInverso[k] = 65536 / k redondeado
+ *  para k = 2..255 (la entrada 1 no se usa)
+ * -PixEscalarBuffer() para todas las ternas (Anterior, Nuevo, valor), con la
+ *  misma aritmetica que el PIC: escala 8.16 de 24 bits, tres productos de
+ *  8x8, Val de 16 bits y saturacion a 255. Desde el maximo brillo es
+ *  PixEscalarBytes(), (v * s) >> 8 (tools/pix_escalar.c comprueba que el
+ *  ensamblador lo cumple)
+ *
+ * El resultado se compara con el escalado ideal v * Nuevo / Anterior (0 vale
+ * 256, saturado a 255). El error de cada llamada tiene que ser menor que la
+ * cota (-c, por defecto 1 bit, lo que promete CambiarBrillo()). Escribe el
+ * error maximo y la terna donde se da; si se supera la cota en alguna terna,
+ * o la tabla no es correcta, devuelve 1.
+ *
+ * Compilar:	gcc -O2 -o pix_brillo pix_brillo.c -lm
+ *
+ * Uso:
+ * pix_brillo
+ * pix_brillo -f ../led_pixels.c -c 1.0 -v
+ *
+ * Opciones:
+ * -f archivo	led_pixels.c de donde leer la tabla (por defecto ../led_pixels.c)
+ * -c cota		error maximo permitido, en bits (por defecto 1.0, estricto)
+ * -v			escribe cada terna que supera la cota (como mucho 20)
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+static unsigned PixInverso[256];
+
+/*
+ * Busca "PixInverso[256] = {" en el archivo y lee los 256 valores, saltando
+ * los comentarios //. Devuelve 0 si no la encuentra o esta incompleta
+ */
+static int LeerTabla(const char *Nombre){
+	FILE *f = fopen(Nombre, "r");
+	char Linea[512];
+	int Dentro = 0, n = 0;
+
+	if(f == NULL) return 0;
+
+	while(n < 256 && fgets(Linea, sizeof(Linea), f) != NULL){
+		char *p = Linea, *c;
+
+		if(!Dentro){
+			p = strstr(Linea, "PixInverso[256]");
+			if(p == NULL || (p = strchr(p, '{')) == NULL) continue;
+			Dentro = 1;
+			p++;
+		}
+		if((c = strstr(p, "//")) != NULL) *c = 0;
+
+		while(*p && n < 256){
+			if(*p >= '0' && *p <= '9'){
+				PixInverso[n++] = (unsigned)strtoul(p, &p, 10);
+			}else if(*p == '}'){
+				break;
+			}else{
+				p++;
+			}
+		}
+	}
+	fclose(f);
+	return n == 256;
+}
+
+/*
+ * Escalar8(): (v * s) / 256, redondeado hacia abajo
+ */
+static uint8_t Escalar8(uint8_t v, uint8_t s){
+	return (uint8_t)((v * s) >> 8);
+}
+
+/*
+ * PixEscalarBuffer() para un byte, con los mismos tipos que el PIC
+ * (int = 8 bits, long = 16 bits, int32)
+ */
+static uint8_t EscalarByte(uint8_t v, uint8_t Anterior, uint8_t Nuevo){
+	uint32_t Escala;
+	uint8_t E2, E1, E0;
+	uint16_t Val;
+
+	if(Anterior == 0 && Nuevo != 0) return Escalar8(v, Nuevo);
+
+	if(Anterior == 1){
+		Escala = 0;
+	}else{
+		if(Nuevo == 0) Escala = (uint32_t)PixInverso[Anterior] << 8;
+		else Escala = (uint32_t)(uint16_t)PixInverso[Anterior] * Nuevo;	//_mul(long, int)
+	}
+
+	E2 = (uint8_t)(Escala >> 16);
+	E1 = (uint8_t)(Escala >> 8);
+	E0 = (uint8_t)Escala;
+
+	Val = (uint16_t)(v * E1 + (uint8_t)((v * E0) >> 8) + 0x80);
+	Val = (uint16_t)(v * E2 + (uint8_t)(Val >> 8));
+
+	return Val > 255 ? 255 : (uint8_t)Val;
+}
+
+static void Ayuda(void){
+	fprintf(stderr, "Uso: pix_brillo [-f led_pixels.c] [-c cota] [-v]\n");
+}
+
+int main(int argc, char *argv[]){
+	const char *Archivo = "../led_pixels.c";
+	double Cota = 1.0, ErrMax = 0, Suma = 0;
+	int Detalle = 0, Fallos = 0, MalTabla = 0;
+	int PeorA = 0, PeorN = 0, PeorV = 0;
+	int i, a, n, v;
+
+	for(i = 1; i < argc; i++){
+		if(strcmp(argv[i], "-v") == 0){ Detalle = 1; continue; }
+		if(i + 1 >= argc){ Ayuda(); return 2; }
+		if(strcmp(argv[i], "-f") == 0) Archivo = argv[++i];
+		else if(strcmp(argv[i], "-c") == 0) Cota = atof(argv[++i]);
+		else{ Ayuda(); return 2; }
+	}
+	if(Cota <= 0){ Ayuda(); return 2; }
+
+	if(!LeerTabla(Archivo)){
+		fprintf(stderr, "No se encuentra PixInverso[256] completa en %s\n", Archivo);
+		return 1;
+	}
+
+	//la tabla
+	if(PixInverso[0] != 256){
+		printf("PixInverso[0] = %u, tiene que ser 256\n", PixInverso[0]);
+		MalTabla++;
+	}
+	for(a = 2; a < 256; a++){
+		unsigned Ideal = (65536 + a / 2) / a;
+		if(PixInverso[a] != Ideal){
+			printf("PixInverso[%d] = %u, tiene que ser %u\n", a, PixInverso[a], Ideal);
+			MalTabla++;
+		}
+	}
+
+	//todas las ternas. Anterior y Nuevo en el formato de Brillo (0 = 256);
+	//CambiarBrillo() no llama con Nuevo == Anterior
+	for(a = 0; a < 256; a++){
+		int A = a ? a : 256;
+		for(n = 0; n < 256; n++){
+			int N = n ? n : 256;
+			if(n == a) continue;
+			for(v = 0; v < 256; v++){
+				double Ideal, Err;
+				uint8_t r = EscalarByte((uint8_t)v, (uint8_t)a, (uint8_t)n);
+
+				//apagado (1): el buffer es 0 y se queda en 0
+				Ideal = (a == 1) ? 0 : (double)v * N / A;
+				if(Ideal > 255) Ideal = 255;
+				Err = fabs(r - Ideal);
+				Suma += Err;
+
+				if(Err > ErrMax){
+					ErrMax = Err;
+					PeorA = a; PeorN = n; PeorV = v;
+				}
+				if(Err >= Cota){
+					if(Detalle && Fallos < 20)
+						printf("Anterior %3d Nuevo %3d valor %3d: %3u, ideal %.3f (error %.3f)\n",
+							a, n, v, r, Ideal, Err);
+					Fallos++;
+				}
+			}
+		}
+	}
+
+	printf("Tabla PixInverso: %s\n", MalTabla ? "MAL" : "bien");
+	printf("Ternas: %d, error medio %.4f, maximo %.4f (Anterior %d, Nuevo %d, valor %d)\n",
+		256 * 255 * 256, Suma / (256.0 * 255 * 256), ErrMax, PeorA, PeorN, PeorV);
+	printf("Por encima de la cota (%.3f): %d\n", Cota, Fallos);
+
+	return (Fallos || MalTabla) ? 1 : 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * File:   pix_bucles.h
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Tiempos de los chips de LEDs y ciclos de los bucles de envio de
+ * MostrarPixels(), compartidos por los programas del PC pix_genbucle.c y
+ * pix_captura.c para que los dos usen la misma tabla.
+ *
+ * Los ciclos de PIC16 son los que mide pix_genbucle -e en el codigo de
+ * led_pixels_envio.c y led_pixels_gen.c (si no coinciden, -e falla). Los de
+ * PIC18 son los del informe de cada bucle de led_pixels_gen18.c.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef PIX_BUCLES_H
+#define	PIX_BUCLES_H
+
+typedef struct{
+	const char *Nombre;
+	double T0H, T1H, Periodo;	//ns nominales
+	double Tol, TolPeriodo;		//ns
+}Chip;
+
+//Valores tipicos de datasheet. Compruebalos con la hoja de tu lote de LEDs
+static const Chip Chips[] = {
+	{"ws2812",	400,	800,	1250,	150,	600},
+	{"ws2811",	500,	1200,	2500,	150,	600},	//modo 400KHz
+	{"ws2813",	300,	800,	1250,	80,		300},
+	{"ws2815",	300,	800,	1250,	80,		300},
+	{"sk6812",	300,	600,	1250,	150,	600},
+	{"tm1814",	360,	720,	1250,	150,	600},
+};
+#define NUM_CHIPS	(sizeof(Chips) / sizeof(Chips[0]))
+
+//Ciclos de T0H, T1H y periodo de cada bucle. Etiqueta SendByte<MHz>_<KHz>
+//(SendByte18_<MHz>_<KHz> en PIC18) en el archivo indicado
+typedef struct{
+	int MHz, KHz, Pic18;
+	int H0, H1, P;
+	const char *Archivo;
+}Ruta;
+
+static const Ruta Rutas[] = {
+	{16, 400, 0, 2,  5, 10, "led_pixels_envio.c"},
+	{20, 800, 0, 2,  4,  8, "led_pixels_gen.c"},	//625KHz
+	{20, 400, 0, 2,  6, 12, "led_pixels_gen.c"},
+	{24, 400, 0, 3,  7, 15, "led_pixels_envio.c"},
+	{32, 800, 0, 3,  6, 10, "led_pixels_envio.c"},
+	{32, 400, 0, 4, 10, 20, "led_pixels_envio.c"},
+	{40, 800, 0, 4,  8, 12, "led_pixels_gen.c"},
+	{40, 400, 0, 5, 12, 25, "led_pixels_gen.c"},
+	{48, 800, 0, 5, 10, 15, "led_pixels_envio.c"},
+	{48, 400, 0, 6, 14, 32, "led_pixels_envio.c"},	//375KHz: 17 ciclos libres para PIX_HUECO
+	{64, 800, 0, 6, 13, 20, "led_pixels_gen.c"},
+	{64, 400, 0, 8, 19, 40, "led_pixels_gen.c"},
+	{16, 400, 1, 2,  5, 10, "led_pixels_gen18.c"},
+	{20, 800, 1, 2,  4,  8, "led_pixels_gen18.c"},
+	{20, 400, 1, 2,  6, 12, "led_pixels_gen18.c"},
+	{24, 400, 1, 3,  7, 15, "led_pixels_gen18.c"},
+	{32, 800, 1, 3,  6, 10, "led_pixels_gen18.c"},
+	{32, 400, 1, 4, 10, 20, "led_pixels_gen18.c"},
+	{40, 800, 1, 4,  8, 12, "led_pixels_gen18.c"},
+	{40, 400, 1, 5, 12, 25, "led_pixels_gen18.c"},
+	{48, 800, 1, 5, 10, 15, "led_pixels_gen18.c"},
+	{48, 400, 1, 6, 14, 30, "led_pixels_gen18.c"},
+	{64, 800, 1, 6, 13, 20, "led_pixels_gen18.c"},
+	{64, 400, 1, 8, 19, 40, "led_pixels_gen18.c"},
+};
+#define NUM_RUTAS	(sizeof(Rutas) / sizeof(Rutas[0]))
+
+//Chip con el que se comprueba cada bucle: WS2812 a 800KHz, WS2811 a 400KHz
+#define CHIP_RUTA(r)	(&Chips[(r)->KHz == 400 ? 1 : 0])
+
+#endif	/* PIX_BUCLES_H */
@@ -0,0 +1,474 @@
+/*
+ * File:   pix_captura.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Decodificador de capturas del pin de datos WS281x
+ *
+ * Programa para el PC (no para el PIC). Lee una captura de PIX_PIN hecha con
+ * un analizador logico y reconstruye las tramas que ha enviado
+ * MostrarPixels(): una linea CSV por trama con el color de cada LED. Al
+ * final escribe en stderr los histogramas de T0H, T1H, T0L, T1L y periodo,
+ * y el margen de lo medido respecto a la especificacion del chip. Con -m se
+ * comparan ademas con los ciclos del bucle de envio de esa frecuencia.
+ *
+ * La captura se lee en flujo, flanco a flanco, sin cargarla en memoria: el
+ * tamaño del archivo no importa y la velocidad la marca el disco. Solo se
+ * guarda la trama en curso.
+ *
+ * Formatos (-F, por defecto segun la extension):
+ * bin	muestras crudas de 8 canales, un byte por muestra (sigrok-cli -O
+ * 		binary). Necesita -r; -c es el bit del canal
+ * csv	una muestra por linea con un valor por canal (sigrok-cli -O csv, la
+ * 		frecuencia se lee de la cabecera "; Samplerate" o de -r), o una linea
+ * 		por cambio con el tiempo en segundos en la primera columna (Saleae).
+ * 		-c es la columna del canal (por defecto la 0, o la 1 si hay tiempo)
+ * vcd	Value Change Dump (sigrok-cli -O vcd, PulseView). -c es el nombre de
+ * 		la señal; por defecto la primera
+ *
+ * Decodificacion: cada pulso alto es un bit, 1 si dura mas que el umbral (por
+ * defecto a medio camino entre T0H y T1H del chip). Un nivel bajo de mas de
+ * -R uS termina la trama. Los bits se agrupan en bytes (MSB primero) y los
+ * bytes de 3 en 3 en el orden de los LEDs.
+ *
+ * Compilar:	gcc -O2 -o pix_captura pix_captura.c
+ *
+ * Uso:
+ * pix_captura -f tira.bin -r 24000000 -c 0 -m 48 -k 800
+ * sigrok-cli -d fx2lafw -c samplerate=24m --samples 100m -O binary | pix_captura -F bin -r 24000000 -q
+ * pix_captura -f tira.vcd -C ws2811 -m 32 -k 400 -18
+ *
+ * Opciones:
+ * -f archivo	captura (por defecto o con "-", la entrada estandar)
+ * -F formato	bin, csv o vcd
+ * -r Hz		frecuencia de muestreo (bin, y csv sin cabecera de sigrok)
+ * -c canal		bit (bin), columna (csv, desde 0) o nombre (vcd)
+ * -C chip		ws2812, ws2811, ws2813, ws2815, sk6812, tm1814 (por defecto
+ * 				ws2812, o ws2811 con -k 400)
+ * -m MHz		frecuencia del PIC: muestra los ciclos del bucle de envio (los
+ * 				de pix_bucles.h, que comprueba pix_genbucle -e en el codigo)
+ * -k KHz		800 o 400 (por defecto 800)
+ * -18			bucles de PIC18
+ * -o orden		grb, rgb o bgr: orden de los bytes en la tira (por defecto grb)
+ * -u ns		umbral entre bit 0 y bit 1
+ * -R uS		nivel bajo que separa tramas (por defecto 40)
+ * -H ns		ancho de las barras de los histogramas (por defecto 25)
+ * -q			sin lineas de trama, solo el informe
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "pix_bucles.h"	//chips y ciclos de cada bucle, los de pix_genbucle -e
+
+#define MAX_NS		5000	//los histogramas llegan hasta aqui; lo demas va a la ultima barra
+
+/* HISTOGRAMAS */
+typedef struct{
+	const char *Nombre;
+	unsigned long long n;
+	double Min, Max, Suma;
+	unsigned long long *Barras;
+}Histo;
+
+enum{H_T0H, H_T1H, H_T0L, H_T1L, H_PERIODO, NUM_HISTOS};
+
+static Histo Histos[NUM_HISTOS] = {
+	{"T0H", 0, 0, 0, 0, NULL}, {"T1H", 0, 0, 0, 0, NULL}, {"T0L", 0, 0, 0, 0, NULL},
+	{"T1L", 0, 0, 0, 0, NULL}, {"Periodo", 0, 0, 0, 0, NULL}
+};
+static double Ancho = 25;	//ns por barra
+static int NumBarras;
+
+static void Anotar(int h, double ns){
+	Histo *p = &Histos[h];
+	int b = (int)(ns / Ancho + 1e-6);	//sin que el redondeo baje de barra
+
+	if(b >= NumBarras) b = NumBarras - 1;
+	p->Barras[b]++;
+	if(p->n == 0 || ns < p->Min) p->Min = ns;
+	if(p->n == 0 || ns > p->Max) p->Max = ns;
+	p->Suma += ns;
+	p->n++;
+}
+
+/* DECODIFICADOR */
+static double Umbral = 0;		//ns: pulso alto mas largo = bit 1
+static double ResetNs = 40000;	//ns en bajo que terminan la trama
+static int Orden = 0;			//0 GRB, 1 RGB, 2 BGR
+static int Silencio = 0;		//-q
+
+static int Nivel = -1;			//-1: todavia no se conoce
+static double TSubida = -1;		//ultimo flanco de subida
+static double TBajada = -1;		//ultimo flanco de bajada
+static int UltimoBit = -1;		//bit del pulso anterior dentro de la trama
+
+static unsigned char *Bytes = NULL;
+static size_t NumBytes = 0, Capacidad = 0;
+static int Byte = 0, NumBits = 0;
+static double TInicio = 0;		//primer flanco de la trama
+
+static unsigned long long Tramas = 0, BitsSueltos = 0, TramasRaras = 0;
+static size_t MinLeds = (size_t)-1, MaxLeds = 0;
+
+static void FinTrama(void){
+	size_t n, Leds = NumBytes / 3;
+
+	if(NumBytes == 0 && NumBits == 0) return;
+	Tramas++;
+	if(NumBits != 0 || NumBytes % 3 != 0){
+		TramasRaras++;
+		BitsSueltos += NumBits + (NumBytes % 3) * 8;
+	}
+	if(Leds < MinLeds) MinLeds = Leds;
+	if(Leds > MaxLeds) MaxLeds = Leds;
+
+	if(!Silencio){
+		printf("%llu,%.3f,%zu,%d", Tramas, TInicio / 1e6, Leds, NumBits + (int)(NumBytes % 3) * 8);
+		for(n = 0; n < Leds; n++){
+			const unsigned char *p = Bytes + n * 3;
+			int r, g, b;
+			if(Orden == 1){ r = p[0]; g = p[1]; b = p[2]; }
+			else if(Orden == 2){ b = p[0]; g = p[1]; r = p[2]; }
+			else{ g = p[0]; r = p[1]; b = p[2]; }
+			printf(",%02X%02X%02X", r, g, b);
+		}
+		printf("\n");
+	}
+
+	NumBytes = 0;
+	NumBits = 0;
+	Byte = 0;
+	UltimoBit = -1;
+}
+
+static void GuardarBit(int b){
+	Byte = (Byte << 1) | b;
+	if(++NumBits < 8) return;
+
+	if(NumBytes == Capacidad){
+		Capacidad = Capacidad ? Capacidad * 2 : 4096;
+		Bytes = realloc(Bytes, Capacidad);
+		if(Bytes == NULL){
+			fprintf(stderr, "Sin memoria para la trama\n");
+			exit(1);
+		}
+	}
+	Bytes[NumBytes++] = (unsigned char)Byte;
+	Byte = 0;
+	NumBits = 0;
+}
+
+/*
+ * Cambio de nivel en el instante t (ns). Todos los formatos acaban aqui
+ */
+static void Flanco(double t, int v){
+	if(v == Nivel) return;
+
+	if(Nivel < 0){
+		//primer valor: no es un flanco
+		Nivel = v;
+		if(v == 0) TBajada = t;
+		return;
+	}
+	Nivel = v;
+
+	if(v){
+		//subida: termina el nivel bajo del bit anterior o la trama
+		if(TBajada >= 0 && (t - TBajada) > ResetNs) FinTrama();
+		if(UltimoBit >= 0){
+			Anotar(UltimoBit ? H_T1L : H_T0L, t - TBajada);
+			Anotar(H_PERIODO, t - TSubida);
+		}
+		if(NumBytes == 0 && NumBits == 0) TInicio = t;
+		TSubida = t;
+	}else{
+		//bajada: el pulso alto es un bit
+		if(TSubida >= 0){
+			double h = t - TSubida;
+			int b = h > Umbral;
+			Anotar(b ? H_T1H : H_T0H, h);
+			GuardarBit(b);
+			UltimoBit = b;
+		}
+		TBajada = t;
+	}
+}
+
+/* LECTORES */
+static int LeerBin(FILE *f, double Hz, int Canal){
+	static unsigned char Buf[1 << 16];
+	unsigned long long i = 0;
+	size_t n, k;
+
+	if(Hz <= 0){
+		fprintf(stderr, "El formato bin necesita -r\n");
+		return 0;
+	}
+	while((n = fread(Buf, 1, sizeof(Buf), f)) > 0){
+		for(k = 0; k < n; k++, i++){
+			int v = (Buf[k] >> Canal) & 1;
+			if(v != Nivel) Flanco(i * 1e9 / Hz, v);
+		}
+	}
+	return 1;
+}
+
+/*
+ * Devuelve el campo (col) de la linea separada por comas, o NULL
+ */
+static const char *Campo(const char *s, int col){
+	while(col-- > 0){
+		s = strchr(s, ',');
+		if(s == NULL) return NULL;
+		s++;
+	}
+	while(*s == ' ' || *s == '\t') s++;
+	return s;
+}
+
+static int LeerCsv(FILE *f, double Hz, int Canal){
+	char Linea[4096];
+	unsigned long long i = 0;
+	int Modo = 0;	//0 sin decidir, 1 muestras, 2 tiempo + valor
+
+	while(fgets(Linea, sizeof(Linea), f)){
+		const char *c;
+
+		if(strchr(Linea, '\n') == NULL && !feof(f)){
+			fprintf(stderr, "Linea de CSV demasiado larga\n");
+			return 0;
+		}
+		if(Linea[0] == ';' || Linea[0] == '#'){
+			const char *s = strstr(Linea, "Samplerate:");
+			if(s != NULL && Hz <= 0){
+				char Unidad[8] = "";
+				if(sscanf(s + 11, "%lf %7s", &Hz, Unidad) >= 1){
+					if(Unidad[0] == 'k' || Unidad[0] == 'K') Hz *= 1e3;
+					else if(Unidad[0] == 'M') Hz *= 1e6;
+					else if(Unidad[0] == 'G') Hz *= 1e9;
+				}
+			}
+			continue;
+		}
+		if(!isdigit((unsigned char)Linea[0]) && Linea[0] != '-' && Linea[0] != '.') continue;	//cabecera
+
+		if(Modo == 0){
+			//con decimales en la primera columna es el tiempo
+			Modo = (strcspn(Linea, ".eE") < strcspn(Linea, ",\r\n")) ? 2 : 1;
+			if(Canal < 0) Canal = (Modo == 2) ? 1 : 0;
+			if(Modo == 1 && Hz <= 0){
+				fprintf(stderr, "CSV de muestras sin frecuencia: usar -r\n");
+				return 0;
+			}
+		}
+
+		c = Campo(Linea, Canal);
+		if(c == NULL) continue;
+		if(Modo == 2)
+			Flanco(atof(Linea) * 1e9, atoi(c) != 0);
+		else
+			Flanco(i++ * 1e9 / Hz, atoi(c) != 0);
+	}
+	return 1;
+}
+
+static int LeerVcd(FILE *f, const char *Nombre){
+	char Tok[256], Id[64] = "", Var[5][64];
+	double Escala = 1;	//ns por unidad de tiempo
+	double t = 0;
+	int k;
+
+	//cabecera
+	while(fscanf(f, "%255s", Tok) == 1){
+		if(strcmp(Tok, "$timescale") == 0){
+			double n = 1;
+			char u[16] = "";
+			if(fscanf(f, "%255s", Tok) != 1) return 0;
+			if(sscanf(Tok, "%lf%15s", &n, u) < 2 && fscanf(f, "%15s", u) != 1) return 0;
+			if(strcmp(u, "s") == 0) Escala = n * 1e9;
+			else if(strcmp(u, "ms") == 0) Escala = n * 1e6;
+			else if(strcmp(u, "us") == 0) Escala = n * 1e3;
+			else if(strcmp(u, "ns") == 0) Escala = n;
+			else if(strcmp(u, "ps") == 0) Escala = n * 1e-3;
+			else if(strcmp(u, "fs") == 0) Escala = n * 1e-6;
+		}else if(strcmp(Tok, "$var") == 0){
+			//$var tipo ancho id nombre $end
+			for(k = 0; k < 5; k++)
+				if(fscanf(f, "%63s", Var[k]) != 1) return 0;
+			if(Id[0] == 0 && (Nombre == NULL || strcmp(Var[3], Nombre) == 0))
+				snprintf(Id, sizeof(Id), "%s", Var[2]);
+		}else if(strcmp(Tok, "$enddefinitions") == 0){
+			break;
+		}
+	}
+	if(Id[0] == 0){
+		fprintf(stderr, "No se encuentra la señal %s en el VCD\n", Nombre ? Nombre : "");
+		return 0;
+	}
+
+	//cambios
+	while(fscanf(f, "%255s", Tok) == 1){
+		if(Tok[0] == '#'){
+			t = atof(Tok + 1) * Escala;
+		}else if((Tok[0] == '0' || Tok[0] == '1') && strcmp(Tok + 1, Id) == 0){
+			Flanco(t, Tok[0] == '1');
+		}else if(Tok[0] == 'b' || Tok[0] == 'r'){
+			if(fscanf(f, "%255s", Tok) != 1) break;	//vector: se salta su id
+		}
+	}
+	return 1;
+}
+
+/* INFORME */
+static double Margen(const Histo *h, double nom, double tol){
+	double a = h->Min - (nom - tol);
+	double b = (nom + tol) - h->Max;
+	return a < b ? a : b;
+}
+
+static void Informe(const Chip *c, const Ruta *r){
+	int i, b;
+
+	fprintf(stderr, "\nTramas: %llu (%llu con bits que no completan un LED, %llu bits)\n", Tramas, TramasRaras, BitsSueltos);
+	if(Tramas) fprintf(stderr, "LEDs por trama: %zu-%zu\n", MinLeds, MaxLeds);
+	fprintf(stderr, "Umbral bit 0/1: %.0f ns, fin de trama: %.1f uS\n", Umbral, ResetNs / 1000);
+
+	for(i = 0; i < NUM_HISTOS; i++){
+		Histo *h = &Histos[i];
+		unsigned long long Max = 0;
+
+		if(h->n == 0) continue;
+		fprintf(stderr, "\n%s: %llu pulsos, min %.1f, media %.1f, max %.1f ns\n", h->Nombre, h->n, h->Min, h->Suma / h->n, h->Max);
+		for(b = 0; b < NumBarras; b++) if(h->Barras[b] > Max) Max = h->Barras[b];
+		for(b = 0; b < NumBarras; b++){
+			int Largo;
+			if(h->Barras[b] == 0) continue;
+			Largo = (int)((h->Barras[b] * 50 + Max - 1) / Max);
+			fprintf(stderr, "  %5.0f%s %12llu ", b * Ancho, b == NumBarras - 1 ? "+" : " ", h->Barras[b]);
+			while(Largo--) fputc('#', stderr);
+			fputc('\n', stderr);
+		}
+	}
+
+	fprintf(stderr, "\nMargen respecto a %s (peor caso medido):\n", c->Nombre);
+	if(Histos[H_T0H].n) fprintf(stderr, "  T0H      %6.0f +-%-4.0f  %7.1f ns\n", c->T0H, c->Tol, Margen(&Histos[H_T0H], c->T0H, c->Tol));
+	if(Histos[H_T1H].n) fprintf(stderr, "  T1H      %6.0f +-%-4.0f  %7.1f ns\n", c->T1H, c->Tol, Margen(&Histos[H_T1H], c->T1H, c->Tol));
+	if(Histos[H_PERIODO].n) fprintf(stderr, "  Periodo  %6.0f +-%-4.0f  %7.1f ns\n", c->Periodo, c->TolPeriodo, Margen(&Histos[H_PERIODO], c->Periodo, c->TolPeriodo));
+
+	if(r != NULL){
+		double tcy = 4000.0 / r->MHz;
+		fprintf(stderr, "\nBucle de %d MHz / %d KHz%s: ciclos   esperado   medio\n", r->MHz, r->KHz, r->Pic18 ? " (PIC18)" : "");
+		fprintf(stderr, "  T0H                         %4d  %8.1f  %7.1f\n", r->H0, r->H0 * tcy, Histos[H_T0H].n ? Histos[H_T0H].Suma / Histos[H_T0H].n : 0);
+		fprintf(stderr, "  T1H                         %4d  %8.1f  %7.1f\n", r->H1, r->H1 * tcy, Histos[H_T1H].n ? Histos[H_T1H].Suma / Histos[H_T1H].n : 0);
+		fprintf(stderr, "  Periodo                     %4d  %8.1f  %7.1f\n", r->P, r->P * tcy, Histos[H_PERIODO].n ? Histos[H_PERIODO].Suma / Histos[H_PERIODO].n : 0);
+		if(r->Pic18) fprintf(stderr, "  (cada 256 bytes el bit 0 tiene 2 ciclos mas en bajo)\n");
+	}
+}
+
+static void Ayuda(void){
+	printf("Uso: pix_captura [-f archivo] [-F bin|csv|vcd] [-r Hz] [-c canal] [-C chip] [-m MHz] [-k 800|400] [-18]\n");
+	printf("                 [-o grb|rgb|bgr] [-u ns] [-R uS] [-H ns] [-q]\n");
+	printf("Chips: ws2812 ws2811 ws2813 ws2815 sk6812 tm1814\n");
+}
+
+int main(int argc, char **argv){
+	const char *Archivo = NULL, *Formato = NULL, *Canal = NULL, *NombreChip = NULL;
+	const Chip *c = NULL;
+	const Ruta *r = NULL;
+	double Hz = 0;
+	int MHz = 0, KHz = 800, Pic18 = 0, ok, i;
+	FILE *f = stdin;
+
+	for(i = 1; i < argc; i++){
+		const char *op = argv[i];
+		const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if(strcmp(op, "-q") == 0){ Silencio = 1; continue; }
+		if(strcmp(op, "-18") == 0){ Pic18 = 1; continue; }
+		if(v == NULL){ Ayuda(); return 2; }
+		i++;
+
+		if(strcmp(op, "-f") == 0) Archivo = v;
+		else if(strcmp(op, "-F") == 0) Formato = v;
+		else if(strcmp(op, "-r") == 0) Hz = atof(v);
+		else if(strcmp(op, "-c") == 0) Canal = v;
+		else if(strcmp(op, "-C") == 0) NombreChip = v;
+		else if(strcmp(op, "-m") == 0) MHz = atoi(v);
+		else if(strcmp(op, "-k") == 0) KHz = atoi(v);
+		else if(strcmp(op, "-u") == 0) Umbral = atof(v);
+		else if(strcmp(op, "-R") == 0) ResetNs = atof(v) * 1000;
+		else if(strcmp(op, "-H") == 0) Ancho = atof(v);
+		else if(strcmp(op, "-o") == 0){
+			if(strcmp(v, "grb") == 0) Orden = 0;
+			else if(strcmp(v, "rgb") == 0) Orden = 1;
+			else if(strcmp(v, "bgr") == 0) Orden = 2;
+			else{ Ayuda(); return 2; }
+		}else{
+			Ayuda();
+			return 2;
+		}
+	}
+
+	if(NombreChip == NULL) NombreChip = (KHz == 400) ? "ws2811" : "ws2812";
+	for(i = 0; i < (int)NUM_CHIPS; i++)
+		if(strcmp(Chips[i].Nombre, NombreChip) == 0) c = &Chips[i];
+	if(c == NULL){
+		fprintf(stderr, "Chip desconocido: %s\n", NombreChip);
+		return 2;
+	}
+	if(MHz){
+		for(i = 0; i < (int)NUM_RUTAS; i++)
+			if(Rutas[i].MHz == MHz && Rutas[i].KHz == KHz && Rutas[i].Pic18 == Pic18) r = &Rutas[i];
+		if(r == NULL){
+			fprintf(stderr, "MostrarPixels() no tiene bucle de %d KHz a %d MHz\n", KHz, MHz);
+			return 2;
+		}
+	}
+	if(Umbral <= 0) Umbral = (c->T0H + c->T1H) / 2;
+	if(Ancho <= 0 || ResetNs <= 0){
+		Ayuda();
+		return 2;
+	}
+
+	NumBarras = (int)(MAX_NS / Ancho) + 1;
+	for(i = 0; i < NUM_HISTOS; i++){
+		Histos[i].Barras = calloc(NumBarras, sizeof(unsigned long long));
+		if(Histos[i].Barras == NULL) return 1;
+	}
+
+	if(Formato == NULL){
+		const char *e = Archivo ? strrchr(Archivo, '.') : NULL;
+		Formato = (e != NULL) ? e + 1 : "bin";
+	}
+	if(Archivo != NULL && strcmp(Archivo, "-") != 0){
+		f = fopen(Archivo, "rb");
+		if(f == NULL){
+			fprintf(stderr, "No se puede abrir %s\n", Archivo);
+			return 1;
+		}
+	}
+	setvbuf(f, NULL, _IOFBF, 1 << 20);
+
+	if(!Silencio) printf("trama,ms,leds,bits_sueltos,colores...\n");
+
+	if(strcmp(Formato, "bin") == 0) ok = LeerBin(f, Hz, Canal ? atoi(Canal) : 0);
+	else if(strcmp(Formato, "csv") == 0) ok = LeerCsv(f, Hz, Canal ? atoi(Canal) : -1);
+	else if(strcmp(Formato, "vcd") == 0) ok = LeerVcd(f, Canal);
+	else{
+		fprintf(stderr, "Formato desconocido: %s\n", Formato);
+		ok = 0;
+	}
+	if(f != stdin) fclose(f);
+	if(!ok) return 1;
+
+	FinTrama();		//la captura puede acabar sin el reset
+	Informe(c, r);
+
+	return 0;
+}
@@ -0,0 +1,391 @@
+/*
+ * File:   pix_escalar.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Prueba en el PC del ensamblador de Escalar8() y PixEscalarBytes() (PIC16)
+ *
+ * Programa para el PC (no para el PIC). Lee los bloques #asm de las dos
+ * funciones de led_pixels.c (el mismo codigo que compila el PIC, no una
+ * copia) y los ejecuta instruccion a instruccion en un modelo de registros
+ * del PIC16: W, STATUS (C, DC, Z), FSR0/INDF0 y las variables de la funcion.
+ * Comprueba:
+ *
+ * -Escalar8(v, s) para los 65536 pares, con W y C de entrada a basura, contra
+ *  (v * s) >> 8, y que tarda siempre los mismos ciclos
+ * -PixEscalarBytes() para los 65536 pares (256 llamadas de 256 bytes, una
+ *  por escala), contra (v * s) >> 8
+ * -PixEscalarBytes() con longitudes de 1 a 1024 bytes y el buffer cruzando
+ *  paginas de 256 (acarreo de FSR0L a FSR0H): escribe exactamente esos bytes
+ *  y no toca los de alrededor
+ *
+ * Escribe los ciclos por llamada y por byte. Si algo no coincide, o hay una
+ * instruccion que el modelo no conoce, devuelve 1.
+ *
+ * Compilar:	gcc -O2 -o pix_escalar pix_escalar.c
+ *
+ * Uso:
+ * pix_escalar
+ * pix_escalar -f ../led_pixels.c
+ *
+ * Opciones:
+ * -f archivo	led_pixels.c de donde leer el ensamblador (por defecto ../led_pixels.c)
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAX_INST	256
+#define MAX_REG		16
+
+//Registros con nombre: variables de la funcion y SFR
+enum{R_STATUS, R_INDF0, R_FSR0L, R_FSR0H, R_PRIMERA_VAR};
+
+typedef struct{
+	char Op[8];
+	int f;			//registro (indice en Reg) o -1
+	int b;			//bit, destino (0 = W, 1 = F) o literal
+	int Salto;		//instruccion destino de GOTO
+	char Etiqueta[32];	//etiqueta de GOTO, se resuelve al final
+	int Linea;
+}Inst;
+
+typedef struct{
+	Inst I[MAX_INST];
+	int N;
+	char Nombre[MAX_REG][32];
+	int NumReg;
+	char Etiqueta[MAX_INST][32];
+	int EtiquetaPos[MAX_INST];
+	int NumEtiquetas;
+}Programa;
+
+//Estado del PIC
+static uint8_t W, Reg[MAX_REG];
+static uint8_t Ram[65536];
+static long Ciclos;
+
+#define C_BIT	0x01
+#define DC_BIT	0x02
+#define Z_BIT	0x04
+
+static int Registro(Programa *p, const char *n){
+	int k;
+	static const char *Sfr[] = {"STATUS", "INDF0", "FSR0L", "FSR0H"};
+
+	for(k = 0; k < R_PRIMERA_VAR; k++) if(strcmp(n, Sfr[k]) == 0) return k;
+	for(k = R_PRIMERA_VAR; k < p->NumReg; k++) if(strcmp(n, p->Nombre[k]) == 0) return k;
+	if(p->NumReg >= MAX_REG) return -1;
+	snprintf(p->Nombre[p->NumReg], sizeof(p->Nombre[0]), "%s", n);
+	return p->NumReg++;
+}
+
+static int VarRegistro(Programa *p, const char *n){
+	int k;
+	for(k = R_PRIMERA_VAR; k < p->NumReg; k++) if(strcmp(n, p->Nombre[k]) == 0) return k;
+	return -1;
+}
+
+/*
+ * Lee el primer bloque #asm ... #endasm despues de la linea que contiene
+ * (Firma). Devuelve 0 si no lo encuentra o tiene algo que no se entiende
+ */
+static int LeerAsm(const char *Archivo, const char *Firma, Programa *p){
+	FILE *f = fopen(Archivo, "r");
+	char Linea[256];
+	int Estado = 0, NumLinea = 0, k, j;
+
+	memset(p, 0, sizeof(*p));
+	p->NumReg = R_PRIMERA_VAR;
+	if(f == NULL) return 0;
+
+	while(fgets(Linea, sizeof(Linea), f) != NULL){
+		char *c, Tok[3][32];
+		int n;
+
+		NumLinea++;
+		if(Estado == 0){
+			if(strstr(Linea, Firma) != NULL) Estado = 1;
+			continue;
+		}
+		if(Estado == 1){
+			if(strstr(Linea, "#asm") != NULL) Estado = 2;
+			continue;
+		}
+		if(strstr(Linea, "#endasm") != NULL){ Estado = 3; break; }
+
+		if((c = strchr(Linea, ';')) != NULL) *c = 0;
+		for(c = Linea; *c; c++) if(*c == ',') *c = ' ';
+		n = sscanf(Linea, "%31s %31s %31s", Tok[0], Tok[1], Tok[2]);
+		if(n <= 0) continue;
+
+		k = (int)strlen(Tok[0]);
+		if(Tok[0][k - 1] == ':'){
+			Tok[0][k - 1] = 0;
+			strcpy(p->Etiqueta[p->NumEtiquetas], Tok[0]);
+			p->EtiquetaPos[p->NumEtiquetas++] = p->N;
+			continue;
+		}
+
+		if(p->N >= MAX_INST){ fclose(f); return 0; }
+		Inst *in = &p->I[p->N++];
+		strncpy(in->Op, Tok[0], 7);
+		in->f = -1;
+		in->Linea = NumLinea;
+
+		if(strcmp(in->Op, "GOTO") == 0){
+			if(n < 2){ fclose(f); return 0; }
+			strcpy(in->Etiqueta, Tok[1]);
+			continue;
+		}
+		if(strcmp(in->Op, "MOVLW") == 0){
+			if(n < 2){ fclose(f); return 0; }
+			in->b = (int)strtol(Tok[1], NULL, 0);
+			continue;
+		}
+		if(n < 2){ fclose(f); return 0; }
+		in->f = Registro(p, Tok[1]);
+		if(in->f < 0){ fclose(f); return 0; }
+		if(n == 3){
+			if(strcmp(Tok[2], "W") == 0) in->b = 0;
+			else if(strcmp(Tok[2], "F") == 0) in->b = 1;
+			else in->b = atoi(Tok[2]);
+		}else{
+			in->b = 1;
+		}
+	}
+	fclose(f);
+	if(Estado != 3 || p->N == 0) return 0;
+
+	//destinos de los GOTO
+	for(k = 0; k < p->N; k++){
+		Inst *in = &p->I[k];
+		if(strcmp(in->Op, "GOTO") != 0) continue;
+		in->Salto = -1;
+		for(j = 0; j < p->NumEtiquetas; j++) if(strcmp(p->Etiqueta[j], in->Etiqueta) == 0) in->Salto = p->EtiquetaPos[j];
+		if(in->Salto < 0){
+			fprintf(stderr, "Linea %d: etiqueta %s desconocida\n", in->Linea, in->Etiqueta);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static uint8_t Leer(int f){
+	if(f == R_INDF0) return Ram[(Reg[R_FSR0H] << 8) | Reg[R_FSR0L]];
+	return Reg[f];
+}
+
+static void Escribir(int f, uint8_t v){
+	if(f == R_INDF0) Ram[(Reg[R_FSR0H] << 8) | Reg[R_FSR0L]] = v;
+	else Reg[f] = v;
+}
+
+static void PonZ(uint8_t v){
+	if(v == 0) Reg[R_STATUS] |= Z_BIT;
+	else Reg[R_STATUS] &= ~Z_BIT;
+}
+
+static void Destino(const Inst *in, uint8_t v){
+	if(in->b) Escribir(in->f, v);
+	else W = v;
+}
+
+/*
+ * Ejecuta el programa hasta salir por el final. Devuelve 0 si encuentra una
+ * instruccion desconocida o no termina
+ */
+static int Ejecutar(const Programa *p){
+	int pc = 0;
+	long Pasos = 0;
+
+	while(pc < p->N){
+		const Inst *in = &p->I[pc];
+		const char *op = in->Op;
+		uint8_t v;
+		unsigned s;
+
+		if(++Pasos > 10000000L) return 0;
+		Ciclos++;
+		pc++;
+
+		if(strcmp(op, "CLRF") == 0){
+			Escribir(in->f, 0);
+			Reg[R_STATUS] |= Z_BIT;
+		}else if(strcmp(op, "MOVF") == 0){
+			v = Leer(in->f);
+			PonZ(v);
+			Destino(in, v);
+		}else if(strcmp(op, "MOVWF") == 0){
+			Escribir(in->f, W);
+		}else if(strcmp(op, "MOVLW") == 0){
+			W = (uint8_t)in->b;
+		}else if(strcmp(op, "BCF") == 0){
+			Escribir(in->f, Leer(in->f) & ~(1 << in->b));
+		}else if(strcmp(op, "BSF") == 0){
+			Escribir(in->f, Leer(in->f) | (1 << in->b));
+		}else if(strcmp(op, "BTFSC") == 0 || strcmp(op, "BTFSS") == 0){
+			int Bit = (Leer(in->f) >> in->b) & 1;
+			if(Bit == (op[4] == 'S')){ pc++; Ciclos++; }
+		}else if(strcmp(op, "ADDWF") == 0){
+			v = Leer(in->f);
+			s = (unsigned)v + W;
+			Reg[R_STATUS] &= ~(C_BIT | DC_BIT);
+			if(s > 0xFF) Reg[R_STATUS] |= C_BIT;
+			if(((v & 0x0F) + (W & 0x0F)) > 0x0F) Reg[R_STATUS] |= DC_BIT;
+			PonZ((uint8_t)s);
+			Destino(in, (uint8_t)s);
+		}else if(strcmp(op, "RRF") == 0){
+			v = Leer(in->f);
+			s = (v >> 1) | ((Reg[R_STATUS] & C_BIT) ? 0x80 : 0);
+			if(v & 1) Reg[R_STATUS] |= C_BIT;
+			else Reg[R_STATUS] &= ~C_BIT;
+			Destino(in, (uint8_t)s);
+		}else if(strcmp(op, "INCF") == 0){
+			v = Leer(in->f) + 1;
+			PonZ(v);
+			Destino(in, v);
+		}else if(strcmp(op, "DECFSZ") == 0){
+			v = Leer(in->f) - 1;
+			Destino(in, v);
+			if(v == 0){ pc++; Ciclos++; }
+		}else if(strcmp(op, "GOTO") == 0){
+			pc = in->Salto;
+			Ciclos++;
+		}else{
+			fprintf(stderr, "Linea %d: instruccion %s desconocida para el modelo\n", in->Linea, op);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/*
+ * La parte en C de PixEscalarBytes() antes del #asm
+ */
+static int EscalarBytes(const Programa *p, int rs, int rnl, int rnh, unsigned ptr, unsigned Bytes, uint8_t s){
+	uint8_t nl, nh;
+
+	if(Bytes == 0) return 1;
+	nl = (uint8_t)Bytes;
+	nh = (uint8_t)(Bytes >> 8);
+	if(nl != 0) nh++;
+
+	Reg[rs] = s;
+	Reg[rnl] = nl;
+	Reg[rnh] = nh;
+	Reg[R_FSR0L] = (uint8_t)ptr;
+	Reg[R_FSR0H] = (uint8_t)(ptr >> 8);
+	return Ejecutar(p);
+}
+
+static void Ayuda(void){
+	fprintf(stderr, "Uso: pix_escalar [-f led_pixels.c]\n");
+}
+
+int main(int argc, char *argv[]){
+	const char *Archivo = "../led_pixels.c";
+	static Programa E8, EB;
+	int rv, rs, rh, rnl, rnh, rsb;
+	long Fallos = 0, CicMin = 1L << 30, CicMax = 0;
+	unsigned v, s, Len, Base;
+	int i;
+
+	for(i = 1; i < argc; i++){
+		if(strcmp(argv[i], "-f") == 0 && i + 1 < argc) Archivo = argv[++i];
+		else{ Ayuda(); return 2; }
+	}
+
+	if(!LeerAsm(Archivo, "int Escalar8(int v, int s){", &E8)){
+		fprintf(stderr, "No se puede leer el #asm de Escalar8() en %s\n", Archivo);
+		return 1;
+	}
+	if(!LeerAsm(Archivo, "void PixEscalarBytes(int *ptr, long Bytes, int s){", &EB)){
+		fprintf(stderr, "No se puede leer el #asm de PixEscalarBytes() en %s\n", Archivo);
+		return 1;
+	}
+	rv = VarRegistro(&E8, "v");
+	rs = VarRegistro(&E8, "s");
+	rh = VarRegistro(&E8, "h");
+	rsb = VarRegistro(&EB, "s");
+	rnl = VarRegistro(&EB, "nl");
+	rnh = VarRegistro(&EB, "nh");
+	if(rv < 0 || rs < 0 || rh < 0 || rsb < 0 || rnl < 0 || rnh < 0){
+		fprintf(stderr, "El ensamblador no usa las variables esperadas (v, s, h / s, nl, nh)\n");
+		return 1;
+	}
+
+	//Escalar8: todos los pares, con W y C de entrada distintos cada vez
+	for(v = 0; v < 256; v++){
+		for(s = 0; s < 256; s++){
+			memset(Reg, 0xA5, sizeof(Reg));
+			Reg[rv] = (uint8_t)v;
+			Reg[rs] = (uint8_t)s;
+			W = (uint8_t)(v ^ s ^ 0x5A);
+			Reg[R_STATUS] = (uint8_t)((v + s) & C_BIT);
+			Ciclos = 0;
+			if(!Ejecutar(&E8)) return 1;
+			if(Ciclos < CicMin) CicMin = Ciclos;
+			if(Ciclos > CicMax) CicMax = Ciclos;
+			if(Reg[rh] != (uint8_t)((v * s) >> 8)){
+				if(Fallos < 20) printf("Escalar8(%u, %u) = %u, tiene que ser %u\n", v, s, Reg[rh], (v * s) >> 8);
+				Fallos++;
+			}
+		}
+	}
+	printf("Escalar8: 65536 pares, %ld-%ld ciclos\n", CicMin, CicMax);
+	if(CicMin != CicMax){
+		printf("Escalar8 no tarda siempre lo mismo\n");
+		Fallos++;
+	}
+
+	//PixEscalarBytes: un buffer con los 256 valores para cada escala
+	Base = 0x2000;
+	CicMin = 1L << 30;
+	CicMax = 0;
+	for(s = 0; s < 256; s++){
+		for(v = 0; v < 256; v++) Ram[Base + v] = (uint8_t)v;
+		W = (uint8_t)s;
+		Reg[R_STATUS] = (uint8_t)(s & C_BIT);
+		Ciclos = 0;
+		if(!EscalarBytes(&EB, rsb, rnl, rnh, Base, 256, (uint8_t)s)) return 1;
+		if(Ciclos < CicMin) CicMin = Ciclos;
+		if(Ciclos > CicMax) CicMax = Ciclos;
+		for(v = 0; v < 256; v++){
+			if(Ram[Base + v] != (uint8_t)((v * s) >> 8)){
+				if(Fallos < 20) printf("PixEscalarBytes(%u, %u) = %u, tiene que ser %u\n", v, s, Ram[Base + v], (v * s) >> 8);
+				Fallos++;
+			}
+		}
+	}
+	printf("PixEscalarBytes: 65536 pares, %ld-%ld ciclos por 256 bytes (%.2f por byte)\n",
+		CicMin, CicMax, CicMax / 256.0);
+
+	//longitudes y cruces de pagina: solo cambian los bytes pedidos
+	for(Len = 1; Len <= 1024; Len++){
+		unsigned Ini = 0x30F0 + (Len & 0x0F);
+		unsigned k;
+
+		for(k = Ini - 16; k < Ini + Len + 16; k++) Ram[k] = (uint8_t)(k * 7 + 3);
+		if(!EscalarBytes(&EB, rsb, rnl, rnh, Ini, Len, 0x80)) return 1;
+		for(k = Ini - 16; k < Ini + Len + 16; k++){
+			uint8_t Orig = (uint8_t)(k * 7 + 3);
+			uint8_t Esp = (k >= Ini && k < Ini + Len) ? (uint8_t)(Orig >> 1) : Orig;
+			if(Ram[k] != Esp){
+				if(Fallos < 20) printf("PixEscalarBytes de %u bytes desde 0x%04X: byte 0x%04X = %u, tiene que ser %u\n",
+					Len, Ini, k, Ram[k], Esp);
+				Fallos++;
+				break;
+			}
+		}
+	}
+	printf("PixEscalarBytes: longitudes de 1 a 1024 bytes cruzando paginas\n");
+
+	printf("Errores: %ld\n", Fallos);
+	return Fallos ? 1 : 0;
+}
@@ -0,0 +1,772 @@
+/*
+ * File:   pix_genbucle.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Generador de bucles de envio WS281x para MostrarPixels()
+ *
+ * Programa para el PC (no para el PIC). A partir de la frecuencia del PIC y
+ * de los tiempos del chip de LEDs (T0H, T1H y periodo de bit, con tolerancia)
+ * busca la combinacion de ciclos que deja mas margen respecto a los limites y
+ * genera el bloque #asm asis del bucle de 8 bits desenrollado, en el mismo
+ * formato que los de led_pixels.c, precedido de un informe de tiempos como
+ * comentario de C, listo para pegar en el codigo.
+ *
+ * Compilar:	gcc -O2 -o pix_genbucle pix_genbucle.c
+ *
+ * Uso:
+ * pix_genbucle -f 20000000 -c ws2811		//chip predefinido
+ * pix_genbucle -f 40000000 -0 400 -1 800 -p 1250 -t 150 -T 600
+ * pix_genbucle -f 48000000 -c ws2812 -h 5,10,15	//ciclos fijos (T0H,T1H,periodo)
+ * pix_genbucle -e							//comprueba los bucles existentes
+ * pix_genbucle -e ..
+ *
+ * Opciones:
+ * -f Hz		frecuencia del PIC (Fosc)
+ * -c chip		ws2812, ws2811, ws2813, ws2815, sk6812, tm1814
+ * -0 ns		T0H nominal
+ * -1 ns		T1H nominal
+ * -p ns		periodo de bit nominal
+ * -t ns		tolerancia de T0H y T1H
+ * -T ns		tolerancia del periodo
+ * -h a,b,p		no buscar: usar a/b/p ciclos para T0H/T1H/periodo
+ * -n sufijo	sufijo de las etiquetas (por defecto <MHz>_<KHz>)
+ * -s			solo el informe, sin el bloque asm
+ * -18			bucle para PIC18 (POSTINC0 y contador de 16 bits en PRODH:PRODL)
+ * -e [dir]		comprueba los bucles de PIC16 de led_pixels_envio.c y
+ *				led_pixels_gen.c (en dir, por defecto ..): los ciclos
+ *				documentados y los que salen del codigo contra el chip, y el
+ *				codigo contra lo documentado. Escribe los ciclos por byte de
+ *				cada bucle (PIX_BIT_CICLOS y PIX_BYTE_EXTRA de led_pixels.h).
+ *				Devuelve 1 si algo falla (margen negativo, flancos distintos
+ *				de los documentados o bucle que no envia bien)
+ *
+ * Modelo de tiempos: cada instruccion dura 1 ciclo (Tcy = 4/Fosc), los saltos
+ * 2 ciclos, y el pin cambia al final del ciclo de la instruccion BSF/BCF, por
+ * lo que el tiempo en alto es (ciclo del BCF - ciclo del BSF) * Tcy.
+ *
+ * Estructura de cada bit (ciclo entre corchetes):
+ *   [0]		BSF		pin a 1
+ *   [h0-1]		BTFSS	INDF0, bit		si el bit es 1 salta el BCF
+ *   [h0]		BCF		pin a 0 (solo bit a 0)
+ *   [h1]		BCF		pin a 0
+ * El resto son NOP. En el bit 0 hay que meter ademas el control del bucle
+ * (INCF FSR0L, DECFSZ i, GOTO). Se prueban dos formas y se usa la primera que
+ * encaja sin mover ningun flanco:
+ *   A) INCF en un hueco libre y DECFSZ/GOTO SendByte en los 3 ultimos ciclos
+ *   B) DECFSZ + GOTO Salto / GOTO Listo en el hueco entre h0 y h1, como en los
+ *      bucles de 32MHz y 48MHz de led_pixels.c. En la rama Listo (ultimo byte)
+ *      DECFSZ tarda un ciclo mas; si eso retrasa el ultimo BCF se avisa
+ *
+ * En PIC18 (-18) solo se usa la forma A: INCF FSR0L se cambia por
+ * MOVF POSTINC0, W (avanza FSR0 completo, sin limite de 256 bytes), GOTO por
+ * BRA y el contador es de 16 bits: PRODL cuenta los bytes y cada 256 se
+ * decrementa PRODH. Esos 2 ciclos extra caen en el nivel bajo del bit 0, que
+ * admite alargarse sin problema (muy lejos del tiempo de reset).
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pix_bucles.h"
+
+#define MAX_CICLOS	256
+
+static int Pic18 = 0;	//1: genera el bucle para PIC18
+
+typedef struct{
+	int H0, H1, P;			//ciclos de T0H, T1H y periodo
+	int Forma;				//'A' o 'B'
+	int X;					//A: ciclo del INCF. B: ciclo del DECFSZ
+	int RetrasoListo;		//B: ciclos que se retrasa el ultimo BCF del ultimo byte
+}Bucle;
+
+/*
+ * Busca un hueco para el control del bucle en el bit 0
+ * Devuelve 1 y rellena b->Forma / b->X si cabe sin mover los flancos
+ */
+static int Encajar(Bucle *b){
+	int x;
+
+	if(b->H0 < 2 || b->H1 <= b->H0 || b->H1 >= b->P) return 0;
+
+	//Forma A: DECFSZ en P-3, GOTO en P-2..P-1, INCF en cualquier hueco
+	//despues de leer INDF0 (BTFSS en h0-1)
+	if(b->H1 <= b->P - 4){
+		for(x = b->H0 + 1; x < b->P - 3; x++){
+			if(x == b->H1) continue;
+			b->Forma = 'A';
+			b->X = x;
+			b->RetrasoListo = 0;
+			return 1;
+		}
+	}
+
+	if(Pic18) return 0;	//en PIC18 solo la forma A
+
+	//Forma B: DECFSZ en x, GOTO Salto x+1..x+2 (sigue) o GOTO Listo x+2..x+3
+	//(fin), todo antes de h1. Salto: INCF, BCF en h1 y GOTO SendByte al final
+	for(x = b->H0 + 1; x + 3 <= b->H1; x++){
+		int libres = (b->H1 - (x + 3)) + (b->P - 1 - b->H1);	//huecos en rama Salto
+		if(b->H1 > b->P - 3) continue;		//el GOTO final pisa el BCF
+		if(libres < 3) continue;			//INCF + GOTO SendByte
+		b->Forma = 'B';
+		b->X = x;
+		b->RetrasoListo = (x + 4 > b->H1) ? (x + 4 - b->H1) : 0;
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Margen en ns de un valor respecto a la ventana nominal +- tolerancia
+ * Negativo si esta fuera
+ */
+static double Margen(double v, double nom, double tol){
+	double a = v - (nom - tol);
+	double b = (nom + tol) - v;
+	return a < b ? a : b;
+}
+
+static double MargenBucle(const Bucle *b, double tcy, const Chip *c){
+	double m0 = Margen(b->H0 * tcy, c->T0H, c->Tol);
+	double m1 = Margen(b->H1 * tcy, c->T1H, c->Tol);
+	double mp = Margen(b->P * tcy, c->Periodo, c->TolPeriodo);
+	double m = m0 < m1 ? m0 : m1;
+	return m < mp ? m : mp;
+}
+
+/*
+ * Recorre todas las combinaciones de ciclos y se queda con la de mas margen
+ * A igual margen prefiere el periodo mas cercano al nominal
+ */
+static int Buscar(Bucle *mejor, double tcy, const Chip *c){
+	Bucle b;
+	double m, mMejor = -1e9, dMejor = 1e9, d;
+	int pMin = (int)((c->Periodo - c->TolPeriodo) / tcy);
+	int pMax = (int)((c->Periodo + c->TolPeriodo) / tcy) + 1;
+
+	if(pMin < 2) pMin = 2;
+	if(pMax >= MAX_CICLOS) pMax = MAX_CICLOS - 1;
+
+	for(b.P = pMin; b.P <= pMax; b.P++){
+		for(b.H0 = 2; b.H0 < b.P; b.H0++){
+			for(b.H1 = b.H0 + 1; b.H1 < b.P; b.H1++){
+				if(!Encajar(&b)) continue;
+				m = MargenBucle(&b, tcy, c);
+				d = b.P * tcy - c->Periodo;
+				if(d < 0) d = -d;
+				if(m > mMejor || (m == mMejor && d < dMejor)){
+					*mejor = b;
+					mMejor = m;
+					dMejor = d;
+				}
+			}
+		}
+	}
+
+	return mMejor > -1e9;
+}
+
+static void Informe(const Bucle *b, double fosc, const Chip *c){
+	double tcy = 4e9 / fosc;
+
+	printf("// ---------------------------------------------------------------\n");
+	printf("// Fosc = %.0f Hz, Tcy = %.2f ns, chip %s\n", fosc, tcy, c->Nombre);
+	printf("//         ciclos     ns     spec (ns)         margen\n");
+	printf("// T0H     %4d  %7.1f   %6.0f +-%-4.0f      %7.1f\n", b->H0, b->H0 * tcy,
+		c->T0H, c->Tol, Margen(b->H0 * tcy, c->T0H, c->Tol));
+	printf("// T1H     %4d  %7.1f   %6.0f +-%-4.0f      %7.1f\n", b->H1, b->H1 * tcy,
+		c->T1H, c->Tol, Margen(b->H1 * tcy, c->T1H, c->Tol));
+	printf("// T0L     %4d  %7.1f\n", b->P - b->H0, (b->P - b->H0) * tcy);
+	printf("// T1L     %4d  %7.1f\n", b->P - b->H1, (b->P - b->H1) * tcy);
+	printf("// Periodo %4d  %7.1f   %6.0f +-%-4.0f      %7.1f  (%.0f KHz)\n", b->P, b->P * tcy,
+		c->Periodo, c->TolPeriodo, Margen(b->P * tcy, c->Periodo, c->TolPeriodo),
+		1e6 / (b->P * tcy));
+	printf("// Margen minimo: %.1f ns%s\n", MargenBucle(b, tcy, c),
+		MargenBucle(b, tcy, c) < 0 ? "  *** FUERA DE ESPECIFICACION ***" : "");
+	printf("// Control de bucle: forma %c%s", b->Forma, Pic18 ? ", PIC18" : "");
+	if(Pic18)
+		printf(" (cada 256 bytes el nivel bajo del bit 0 dura 2 ciclos mas)");
+	if(b->RetrasoListo)
+		printf(" (el ultimo bit del ultimo byte dura %d ciclo(s) mas en alto)", b->RetrasoListo);
+	printf("\n// ---------------------------------------------------------------\n");
+}
+
+/*
+ * Imprime una instruccion con el comentario alineado con tabuladores (de 4)
+ * en la misma columna que los bloques asm de led_pixels.c
+ */
+static void Linea(const char *instr, int ciclo, const char *coment){
+	const char *c;
+	int col = 4;
+
+	for(c = instr; *c; c++)
+		col = (*c == '\t') ? (col / 4 + 1) * 4 : col + 1;
+
+	printf("\t%s", instr);
+	do{
+		putchar('\t');
+		col = (col / 4 + 1) * 4;
+	}while(col < 28);
+	printf("; [%d] %s\n", ciclo, coment);
+}
+
+static void Nops(int desde, int hasta){
+	int c;
+	for(c = desde; c <= hasta; c++) Linea("NOP", c, "delay");
+}
+
+/*
+ * Genera el bloque asm en el formato de led_pixels.c
+ */
+static void Generar(const Bucle *b, const char *suf){
+	char buf[64];
+	int bit, c;
+
+	printf("#asm asis\n");
+	printf("SendByte%s:\n", suf);
+
+	for(bit = 7; bit >= 0; bit--){
+		printf("\t; ===== BIT %d =====\n", bit);
+		Linea("BSF\t\tPIX_ENV_PORT, PIX_ENV_BIT", 0, "PIX = 1");
+		Nops(1, b->H0 - 2);
+		sprintf(buf, "BTFSS\tINDF0, %d", bit);
+		Linea(buf, b->H0 - 1, "bit a 1: salta el BCF");
+		Linea("BCF\t\tPIX_ENV_PORT, PIX_ENV_BIT", b->H0, "PIX = 0 si bit=0");
+
+		if(bit != 0){
+			Nops(b->H0 + 1, b->H1 - 1);
+			Linea("BCF\t\tPIX_ENV_PORT, PIX_ENV_BIT", b->H1, "PIX = 0");
+			Nops(b->H1 + 1, b->P - 1);
+			printf("\t\n");
+			continue;
+		}
+
+		//bit 0 con el control del bucle
+		if(b->Forma == 'A'){
+			for(c = b->H0 + 1; c < b->P - 3; c++){
+				if(c == b->H1) Linea("BCF\t\tPIX_ENV_PORT, PIX_ENV_BIT", c, "PIX = 0");
+				else if(c == b->X && Pic18) Linea("MOVF\tPOSTINC0, W", c, "incrementar puntero (16 bits)");
+				else if(c == b->X) Linea("INCF\tFSR0L, F", c, "incrementar puntero");
+				else Linea("NOP", c, "delay");
+			}
+			printf("\t; ===== CONTROL DE LOOP =====\n");
+			if(Pic18){
+				Linea("DECFSZ\tPRODL, F", b->P - 3, "decrementar contador (parte baja)");
+				sprintf(buf, "BRA\t\tSendByte%s", suf);
+				Linea(buf, b->P - 2, "si no es cero, siguiente byte");
+				Linea("DECFSZ\tPRODH, F", b->P - 1, "cada 256 bytes: parte alta");
+				Linea(buf, b->P, "alarga 2 ciclos el nivel bajo");
+			}else{
+				Linea("DECFSZ\ti, F", b->P - 3, "decrementar contador");
+				sprintf(buf, "GOTO\tSendByte%s", suf);
+				Linea(buf, b->P - 2, "si no es cero, siguiente byte");
+			}
+			printf("\t; Fin de transmision\n");
+		}else{
+			Nops(b->H0 + 1, b->X - 1);
+			printf("\t; ===== CONTROL DE LOOP =====\n");
+			Linea("DECFSZ\ti, F", b->X, "decrementar contador");
+			sprintf(buf, "GOTO\tSalto%s", suf);
+			Linea(buf, b->X + 1, "si no es cero, continuar");
+			sprintf(buf, "GOTO\tListo%s", suf);
+			Linea(buf, b->X + 2, "si es cero, terminar");
+			printf("\nSalto%s:\n", suf);
+			c = b->X + 3;
+			if(c < b->H1) Linea("INCF\tFSR0L, F", c++, "incrementar puntero");
+			Nops(c, b->H1 - 1);
+			Linea("BCF\t\tPIX_ENV_PORT, PIX_ENV_BIT", b->H1, "PIX = 0");
+			c = b->H1 + 1;
+			if(b->X + 3 >= b->H1) Linea("INCF\tFSR0L, F", c++, "incrementar puntero");
+			Nops(c, b->P - 3);
+			sprintf(buf, "GOTO\tSendByte%s", suf);
+			Linea(buf, b->P - 2, "volver al inicio");
+			printf("\nListo%s:\n", suf);
+			c = b->X + 4;
+			Nops(c, b->H1 - 1);
+			Linea("BCF\t\tPIX_ENV_PORT, PIX_ENV_BIT", c > b->H1 ? c : b->H1, "PIX = 0");
+			printf("\t; Fin de transmision\n");
+		}
+	}
+	printf("#endasm\n");
+}
+
+/* ------------------------- BUCLES ESCRITOS A MANO ---------------------------
+ * -e lee led_pixels_envio.c y led_pixels_gen.c, saca cada bucle (de SendByte<sufijo>: hasta el
+ * final de su seccion), lo ejecuta con un modelo de ciclos y mide los flancos
+ * del pin enviando unos bytes de prueba. Las lineas que entiende:
+ *   C:		output_high/output_low (BSF/BCF, con #use fast_io), delay_cycles(n),
+ *			if(!bit_test(INDF0, k)) output_low() (BTFSS + BCF, 2 ciclos),
+ *			FSR0L++ (INCF), goto (2 ciclos), etiquetas
+ *   asm:	BSF/BCF del pin, NOP, BTFSC/BTFSS INDF0, DECFSZ i, INCF FSR0L, GOTO
+ * Los #if/#ifdef de dentro se toman como falsos (sin PIX_HUECO ni otras
+ * opciones). Un salto de DECFSZ/BTFSx tarda 2 ciclos (GOTO de una palabra).
+ * ---------------------------------------------------------------------------*/
+
+#define MAX_INSTR	512
+#define MAX_ETIQ	64
+#define MAX_LINEA	256
+
+enum{ OP_ALTO, OP_BAJO, OP_BAJO_SI0, OP_ESPERA, OP_SALTA_SI0, OP_SALTA_SI1, OP_GOTO, OP_DECFSZ, OP_INCF };
+
+typedef struct{
+	int Op;
+	int Arg;				//bit de INDF0 o ciclos de espera
+	char Etiqueta[32];		//destino del GOTO
+	int Destino;
+	int Linea;				//linea de led_pixels_envio.c
+}Instr;
+
+typedef struct{
+	Instr I[MAX_INSTR];
+	int N;
+	char Etiq[MAX_ETIQ][32];
+	int EtiqPos[MAX_ETIQ];
+	int NEtiq;
+}Programa;
+
+typedef struct{
+	int H0min, H0max, H1min, H1max, Pmin, Pmax;	//ciclos medidos
+	int Forma;				//'A': DECFSZ con el pin en bajo, 'B': en alto
+	int RetrasoListo;		//ciclos de mas en alto del bit 0 del ultimo byte
+	int ByteMax;			//ciclos por byte, de subida de bit 7 a subida de bit 7
+}Medida;
+
+//Bytes de prueba: cada bit pasa por 0 y por 1, el ultimo acaba en 1
+static const unsigned char Datos[] = {0x00, 0xFF, 0xAA, 0x55};
+#define NUM_DATOS	((int)sizeof(Datos))
+
+/*
+ * Quita los espacios del principio y del final
+ */
+static char *Recortar(char *s){
+	char *e;
+	while(*s == ' ' || *s == '\t') s++;
+	e = s + strlen(s);
+	while(e > s && (e[-1] == ' ' || e[-1] == '\t' || e[-1] == '\r' || e[-1] == '\n')) *--e = 0;
+	return s;
+}
+
+/*
+ * Devuelve 1 si la linea es solo una etiqueta ("Nombre:") y la copia
+ */
+static int EsEtiqueta(const char *s, char *nombre){
+	int n = 0;
+	while((s[n] >= 'A' && s[n] <= 'Z') || (s[n] >= 'a' && s[n] <= 'z') ||
+		(s[n] >= '0' && s[n] <= '9') || s[n] == '_') n++;
+	if(n == 0 || n > 31 || s[n] != ':' || s[n + 1] != 0) return 0;
+	memcpy(nombre, s, n);
+	nombre[n] = 0;
+	return 1;
+}
+
+static int Anadir(Programa *p, int op, int arg, const char *etiq, int linea){
+	Instr *x;
+	if(p->N >= MAX_INSTR) return 0;
+	x = &p->I[p->N++];
+	x->Op = op;
+	x->Arg = arg;
+	snprintf(x->Etiqueta, sizeof(x->Etiqueta), "%s", etiq ? etiq : "");
+	x->Destino = -1;
+	x->Linea = linea;
+	return 1;
+}
+
+/*
+ * Traduce una linea (sin comentarios) de C o de ensamblador
+ * Devuelve 0 si no la entiende
+ */
+static int Traducir(Programa *p, char *s, int Asm, int *BitSi, int linea){
+	char m[16], a[64], e[32];
+	int k;
+
+	if(!Asm){
+		size_t n = strlen(s);
+		if(n && s[n - 1] == ';') s[--n] = 0;
+		s = Recortar(s);
+		if(*BitSi >= 0){
+			//el cuerpo del if: solo vale output_low()
+			k = *BitSi;
+			*BitSi = -1;
+			if(strncmp(s, "output_low(", 11) != 0) return 0;
+			return Anadir(p, OP_BAJO_SI0, k, NULL, linea);
+		}
+		if(strncmp(s, "output_high(", 12) == 0) return Anadir(p, OP_ALTO, 0, NULL, linea);
+		if(strncmp(s, "output_low(", 11) == 0) return Anadir(p, OP_BAJO, 0, NULL, linea);
+		if(sscanf(s, "delay_cycles(%d)", &k) == 1) return Anadir(p, OP_ESPERA, k, NULL, linea);
+		if(sscanf(s, "if(!bit_test(INDF0, %d))", &k) == 1){ *BitSi = k; return 1; }
+		if(strcmp(s, "FSR0L++") == 0) return Anadir(p, OP_INCF, 0, NULL, linea);
+		if(sscanf(s, "goto %31[A-Za-z0-9_]", e) == 1) return Anadir(p, OP_GOTO, 0, e, linea);
+		return 0;
+	}
+
+	a[0] = 0;
+	if(sscanf(s, "%15s %63[^\n]", m, a) < 1) return 0;
+	if(strcmp(m, "NOP") == 0) return Anadir(p, OP_ESPERA, 1, NULL, linea);
+	if(strcmp(m, "BSF") == 0 && strstr(a, "PIX_ENV_PORT")) return Anadir(p, OP_ALTO, 0, NULL, linea);
+	if(strcmp(m, "BCF") == 0 && strstr(a, "PIX_ENV_PORT")) return Anadir(p, OP_BAJO, 0, NULL, linea);
+	if(strcmp(m, "BTFSC") == 0 && sscanf(a, "INDF0, %d", &k) == 1) return Anadir(p, OP_SALTA_SI0, k, NULL, linea);
+	if(strcmp(m, "BTFSS") == 0 && sscanf(a, "INDF0, %d", &k) == 1) return Anadir(p, OP_SALTA_SI1, k, NULL, linea);
+	if(strcmp(m, "GOTO") == 0 && sscanf(a, "%31[A-Za-z0-9_]", e) == 1) return Anadir(p, OP_GOTO, 0, e, linea);
+	if(strcmp(m, "DECFSZ") == 0 && (strncmp(a, "i,", 2) == 0 || strncmp(a, "@i,", 3) == 0))
+		return Anadir(p, OP_DECFSZ, 0, NULL, linea);
+	if(strcmp(m, "INCF") == 0 && strncmp(a, "FSR0L,", 6) == 0) return Anadir(p, OP_INCF, 0, NULL, linea);
+	return 0;
+}
+
+/*
+ * Lee el bucle SendByte<suf> de led_pixels_envio.c
+ * Devuelve 0 y escribe el motivo si no puede
+ */
+static int LeerBucle(const char *Archivo, const char *suf, Programa *p){
+	FILE *f = fopen(Archivo, "r");
+	char Linea[MAX_LINEA], Inicio[48], nombre[32];
+	int Bloque = 0, Asm = 0, Dentro = 0, Prof = 0, Falso = 0, BitSi = -1, n = 0, i, j;
+
+	if(f == NULL){
+		printf("// ERROR: no se puede abrir %s\n", Archivo);
+		return 0;
+	}
+	snprintf(Inicio, sizeof(Inicio), "SendByte%s", suf);
+	p->N = p->NEtiq = 0;
+
+	while(fgets(Linea, sizeof(Linea), f) != NULL){
+		char *s = Linea, *c, *w;
+		n++;
+
+		//quita los comentarios /* */, que pueden ocupar varias lineas
+		for(c = w = Linea; *c; ){
+			if(Bloque){
+				if(c[0] == '*' && c[1] == '/'){ Bloque = 0; c += 2; }
+				else c++;
+			}else if(c[0] == '/' && c[1] == '*'){
+				Bloque = 1;
+				c += 2;
+			}else{
+				*w++ = *c++;
+			}
+		}
+		*w = 0;
+		if((c = strstr(s, "//")) != NULL) *c = 0;
+		s = Recortar(s);
+
+		if(*s == '#'){
+			if(strncmp(s, "#endasm", 7) == 0){ Asm = 0; continue; }
+			if(strncmp(s, "#asm", 4) == 0){ Asm = 1; continue; }
+			if(!Dentro) continue;
+			if(strncmp(s, "#if", 3) == 0){
+				Prof++;
+				if(!Falso) Falso = Prof;
+				continue;
+			}
+			if(Prof == 0) break;		//#else/#elif/#endif de la seccion: fin
+			if(strncmp(s, "#else", 5) == 0 || strncmp(s, "#elif", 5) == 0){
+				//#if falso -> #else verdadero (un #elif se toma como falso)
+				if(Falso == Prof && s[3] == 's') Falso = 0;
+				else if(Falso == 0) Falso = Prof;
+				continue;
+			}
+			if(strncmp(s, "#endif", 6) == 0){
+				if(Falso == Prof) Falso = 0;
+				Prof--;
+				continue;
+			}
+			if(Falso || strncmp(s, "#warning", 8) == 0) continue;
+			printf("// ERROR: linea %d: directiva no soportada: %s\n", n, s);
+			fclose(f);
+			return 0;
+		}
+
+		if(Asm && (c = strchr(s, ';')) != NULL){
+			*c = 0;
+			s = Recortar(s);
+		}
+		if(*s == 0) continue;
+
+		if(!Dentro){
+			if(EsEtiqueta(s, nombre) && strcmp(nombre, Inicio) == 0) Dentro = 1;
+			else continue;
+		}
+		if(Falso) continue;
+
+		if(EsEtiqueta(s, nombre)){
+			if(p->NEtiq >= MAX_ETIQ) break;
+			snprintf(p->Etiq[p->NEtiq], sizeof(p->Etiq[0]), "%s", nombre);
+			p->EtiqPos[p->NEtiq++] = p->N;
+			continue;
+		}
+		if(!Traducir(p, s, Asm, &BitSi, n)){
+			printf("// ERROR: linea %d: no se entiende: %s\n", n, s);
+			fclose(f);
+			return 0;
+		}
+	}
+	fclose(f);
+
+	if(!Dentro){
+		printf("// ERROR: no se encuentra %s: en %s\n", Inicio, Archivo);
+		return 0;
+	}
+	for(i = 0; i < p->N; i++){
+		if(p->I[i].Op != OP_GOTO) continue;
+		for(j = 0; j < p->NEtiq; j++)
+			if(strcmp(p->Etiq[j], p->I[i].Etiqueta) == 0) p->I[i].Destino = p->EtiqPos[j];
+		if(p->I[i].Destino < 0){
+			printf("// ERROR: linea %d: etiqueta %s fuera del bucle\n", p->I[i].Linea, p->I[i].Etiqueta);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/*
+ * Ejecuta el bucle con los bytes de prueba y mide T0H, T1H y periodo de
+ * cada bit. Devuelve 0 y escribe el motivo si el bucle no envia bien
+ */
+static int Simular(const Programa *p, Medida *m){
+	int Subida[8 * NUM_DATOS + 1], Bajada[8 * NUM_DATOS];
+	int t = 0, pc = 0, pin = 0, fsr = 0, i = NUM_DATOS, n = 0, k, DecAlto = 0, Dec = 0;
+
+	while(pc < p->N){
+		const Instr *x = &p->I[pc];
+		int b = (fsr < NUM_DATOS) ? Datos[fsr] : 0;
+
+		if(t > 1000 * NUM_DATOS){
+			printf("// ERROR: el bucle no termina\n");
+			return 0;
+		}
+		if((x->Op == OP_BAJO_SI0 || x->Op == OP_SALTA_SI0 || x->Op == OP_SALTA_SI1) && fsr >= NUM_DATOS){
+			printf("// ERROR: linea %d: lee fuera del buffer\n", x->Linea);
+			return 0;
+		}
+		switch(x->Op){
+		case OP_ALTO:
+			if(pin || n >= 8 * NUM_DATOS){
+				printf("// ERROR: linea %d: subida de mas\n", x->Linea);
+				return 0;
+			}
+			Subida[n++] = t;
+			pin = 1;
+			t++; pc++;
+			break;
+		case OP_BAJO:
+			if(pin) Bajada[n - 1] = t;
+			pin = 0;
+			t++; pc++;
+			break;
+		case OP_BAJO_SI0:
+			if(pin && !((b >> x->Arg) & 1)){
+				Bajada[n - 1] = t + 1;
+				pin = 0;
+			}
+			t += 2; pc++;
+			break;
+		case OP_ESPERA:
+			t += x->Arg; pc++;
+			break;
+		case OP_SALTA_SI0:
+		case OP_SALTA_SI1:
+			if(((b >> x->Arg) & 1) == (x->Op == OP_SALTA_SI1)){ t += 2; pc += 2; }
+			else{ t++; pc++; }
+			break;
+		case OP_GOTO:
+			t += 2; pc = x->Destino;
+			break;
+		case OP_DECFSZ:
+			Dec++;
+			if(pin) DecAlto++;
+			if(--i == 0){ t += 2; pc += 2; }
+			else{ t++; pc++; }
+			break;
+		case OP_INCF:
+			fsr++;
+			t++; pc++;
+			break;
+		}
+	}
+
+	//la forma A tambien avanza el puntero en el ultimo byte
+	if(n != 8 * NUM_DATOS || pin || Dec != NUM_DATOS || fsr < NUM_DATOS - 1){
+		printf("// ERROR: %d bits enviados de %d, %d bytes contados, pin final %d\n",
+			n, 8 * NUM_DATOS, Dec, pin);
+		return 0;
+	}
+
+	m->H0min = m->H1min = m->Pmin = MAX_CICLOS * 4;
+	m->H0max = m->H1max = m->Pmax = m->ByteMax = 0;
+	for(k = 0; k < n; k++){
+		int h = Bajada[k] - Subida[k];
+		if((Datos[k / 8] >> (7 - k % 8)) & 1){
+			if(h < m->H1min) m->H1min = h;
+			if(h > m->H1max) m->H1max = h;
+		}else{
+			if(h < m->H0min) m->H0min = h;
+			if(h > m->H0max) m->H0max = h;
+		}
+		if(k + 1 < n){
+			h = Subida[k + 1] - Subida[k];
+			if(h < m->Pmin) m->Pmin = h;
+			if(h > m->Pmax) m->Pmax = h;
+		}
+		if(k % 8 == 0 && k + 8 < n){
+			h = Subida[k + 8] - Subida[k];
+			if(h > m->ByteMax) m->ByteMax = h;
+		}
+	}
+	if(m->H0max >= m->H1min){
+		printf("// ERROR: T0H y T1H se solapan (%d-%d y %d-%d ciclos): algun bit lee otro bit de INDF0\n",
+			m->H0min, m->H0max, m->H1min, m->H1max);
+		return 0;
+	}
+	m->Forma = DecAlto ? 'B' : 'A';
+	//bit 0 a 1 del ultimo byte (Listo) frente al del segundo byte (Salto)
+	k = (Bajada[n - 1] - Subida[n - 1]) - (Bajada[15] - Subida[15]);
+	m->RetrasoListo = k > 0 ? k : 0;
+	return 1;
+}
+
+static double MargenMedido(const Medida *m, double tcy, const Chip *c){
+	double r = 1e9, v;
+	v = Margen(m->H0min * tcy, c->T0H, c->Tol); if(v < r) r = v;
+	v = Margen(m->H0max * tcy, c->T0H, c->Tol); if(v < r) r = v;
+	v = Margen(m->H1min * tcy, c->T1H, c->Tol); if(v < r) r = v;
+	v = Margen(m->H1max * tcy, c->T1H, c->Tol); if(v < r) r = v;
+	v = Margen(m->Pmin * tcy, c->Periodo, c->TolPeriodo); if(v < r) r = v;
+	v = Margen(m->Pmax * tcy, c->Periodo, c->TolPeriodo); if(v < r) r = v;
+	return r;
+}
+
+/*
+ * Comprueba los bucles de PIC16 de led_pixels_envio.c y led_pixels_gen.c
+ * (en el directorio Dir): los ciclos que documenta cada uno contra el chip,
+ * y los flancos y ciclos reales del codigo contra lo documentado y contra el
+ * chip. Escribe tambien los ciclos por byte, los de PIX_BIT_CICLOS * 8 +
+ * PIX_BYTE_EXTRA en led_pixels.h
+ * Devuelve el numero de fallos
+ */
+static int Existentes(const char *Dir){
+	static Programa p;
+	char Archivo[512], Suf[16];
+	int i, fallos = 0;
+
+	//ciclos documentados de cada bucle: la tabla de pix_bucles.h
+	for(i = 0; i < (int)NUM_RUTAS; i++){
+		const Ruta *r = &Rutas[i];
+		const Chip *c = CHIP_RUTA(r);
+		double Fosc = r->MHz * 1e6, tcy = 4e9 / Fosc, mm;
+		Bucle b;
+		Medida m;
+		int f = 0;
+
+		if(r->Pic18) continue;		//el modelo de ciclos es de PIC16
+
+		b.H0 = r->H0;
+		b.H1 = r->H1;
+		b.P = r->P;
+		snprintf(Suf, sizeof(Suf), "%d_%d", r->MHz, r->KHz);
+
+		printf("\n// ===== SendByte%s: %.0f MHz, %s, documentado %d/%d/%d ciclos =====\n",
+			Suf, Fosc / 1e6, c->Nombre, b.H0, b.H1, b.P);
+		snprintf(Archivo, sizeof(Archivo), "%s/%s", Dir, r->Archivo);
+		if(!LeerBucle(Archivo, Suf, &p) || !Simular(&p, &m)){
+			fallos++;
+			continue;
+		}
+
+		b.Forma = m.Forma;
+		b.X = 0;
+		b.RetrasoListo = m.RetrasoListo;
+		Informe(&b, Fosc, c);
+		if(MargenBucle(&b, tcy, c) < 0) f++;
+
+		mm = MargenMedido(&m, tcy, c);
+		printf("// Medido en el codigo: T0H %d-%d, T1H %d-%d, periodo %d-%d ciclos, margen %.1f ns%s\n",
+			m.H0min, m.H0max, m.H1min, m.H1max, m.Pmin, m.Pmax, mm,
+			mm < 0 ? "  *** FUERA DE ESPECIFICACION ***" : "");
+		printf("// Ciclos por byte: %d (%d * 8 + %d)\n", m.ByteMax, m.Pmin, m.ByteMax - 8 * m.Pmin);
+		if(mm < 0) f++;
+		if(m.H0min != b.H0 || m.H0max != b.H0 || m.H1min != b.H1 || m.H1max != b.H1 ||
+			m.Pmin != b.P || m.Pmax != b.P){
+			printf("// *** EL CODIGO NO COINCIDE CON LO DOCUMENTADO ***\n");
+			f++;
+		}
+		if(f) fallos++;
+	}
+
+	printf("\n// %d bucle(s) con fallos\n", fallos);
+	return fallos;
+}
+
+static void Ayuda(void){
+	printf("Uso: pix_genbucle -f Hz (-c chip | -0 ns -1 ns -p ns -t ns -T ns) [-h a,b,p] [-n sufijo] [-s] [-18]\n");
+	printf("     pix_genbucle -e [directorio de led_pixels]\n");
+	printf("Chips: ws2812 ws2811 ws2813 ws2815 sk6812 tm1814\n");
+}
+
+int main(int argc, char **argv){
+	Chip c = {"personalizado", 0, 0, 0, 150, 600};
+	Bucle b;
+	double fosc = 0;
+	int fijo = 0, soloInforme = 0, i, j;
+	char suf[32] = "";
+
+	for(i = 1; i < argc; i++){
+		const char *op = argv[i];
+		const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if(strcmp(op, "-e") == 0)
+			return Existentes((v && v[0] != '-') ? v : "..") ? 1 : 0;
+		if(strcmp(op, "-s") == 0){ soloInforme = 1; continue; }
+		if(strcmp(op, "-18") == 0){ Pic18 = 1; continue; }
+		if(v == NULL){ Ayuda(); return 2; }
+		i++;
+
+		if(strcmp(op, "-f") == 0) fosc = atof(v);
+		else if(strcmp(op, "-0") == 0) c.T0H = atof(v);
+		else if(strcmp(op, "-1") == 0) c.T1H = atof(v);
+		else if(strcmp(op, "-p") == 0) c.Periodo = atof(v);
+		else if(strcmp(op, "-t") == 0) c.Tol = atof(v);
+		else if(strcmp(op, "-T") == 0) c.TolPeriodo = atof(v);
+		else if(strcmp(op, "-n") == 0) snprintf(suf, sizeof(suf), "%s", v);
+		else if(strcmp(op, "-h") == 0){
+			if(sscanf(v, "%d,%d,%d", &b.H0, &b.H1, &b.P) != 3){ Ayuda(); return 2; }
+			fijo = 1;
+		}else if(strcmp(op, "-c") == 0){
+			for(j = 0; j < (int)NUM_CHIPS; j++)
+				if(strcmp(Chips[j].Nombre, v) == 0) c = Chips[j];
+			if(c.T0H == 0){ fprintf(stderr, "Chip desconocido: %s\n", v); return 2; }
+		}else{
+			Ayuda();
+			return 2;
+		}
+	}
+
+	if(fosc <= 0 || c.T0H <= 0 || c.T1H <= 0 || c.Periodo <= 0){
+		Ayuda();
+		return 2;
+	}
+
+	if(fijo){
+		if(!Encajar(&b)){
+			fprintf(stderr, "Con %d/%d/%d ciclos no cabe el control del bucle\n", b.H0, b.H1, b.P);
+			return 1;
+		}
+	}else if(!Buscar(&b, 4e9 / fosc, &c)){
+		fprintf(stderr, "No hay ninguna combinacion posible a %.0f Hz\n", fosc);
+		return 1;
+	}
+
+	if(suf[0] == 0)
+		snprintf(suf, sizeof(suf), "%.0f_%.0f", fosc / 1e6, 1e6 / (b.P * 4e9 / fosc));
+
+	Informe(&b, fosc, &c);
+	if(!soloInforme) Generar(&b, suf);
+
+	return MargenBucle(&b, 4e9 / fosc, &c) < 0 ? 1 : 0;
+}
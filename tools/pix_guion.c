@@ -0,0 +1,704 @@
+/*
+ * File:   pix_guion.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Ensamblador y simulador de guiones de luces para led_pixels_guion.c
+ *
+ * Programa para el PC (no para el PIC). Lee el guion en texto, lo pasa a los
+ * bytes que interpreta PasoGuion() (led_pixels_guion_op.h, el mismo archivo
+ * que usa el PIC) y escribe el array rom int para pegar en el programa, la
+ * linea #rom de la EEPROM (-e) o un binario (-b).
+ *
+ * Con -s simula N fotogramas con las mismas operaciones que la libreria
+ * (Wheel(), CambiarBrillo(), FundirANegro()) y escribe una linea CSV por
+ * fotograma con las mismas columnas que tools/pix_captura.c, asi que se
+ * puede comparar con lo que sale por el pin:
+ *
+ * trama,ms,leds,bits_sueltos,colores...
+ *
+ * Con -p ademas dibuja una imagen PPM con un fotograma por fila. El simulador
+ * avisa si una instruccion se sale de la tira y termina con error si un
+ * fotograma no llega a ESPERAR (en el PIC PasoGuion() no volveria).
+ *
+ * Compilar:	gcc -O2 -o pix_guion pix_guion.c
+ *
+ * Uso:
+ * pix_guion -f show.txt -n Show > show.h
+ * pix_guion -f show.txt -e 0
+ * pix_guion -f show.txt -s 500 -l 60 -p show.ppm > show.csv
+ *
+ * Opciones:
+ * -f archivo	guion en texto
+ * -n nombre	nombre del array (por defecto Guion)
+ * -e dir		linea #rom para la EEPROM en la direccion dir
+ * -b archivo	escribe los bytes en un binario
+ * -s N			simula N fotogramas en lugar de escribir el guion
+ * -l leds		LEDs de la tira simulada (PIX_NUM_LEDS, por defecto 60)
+ * -r fps		fotogramas por segundo para la columna ms (por defecto 50)
+ * -p archivo	imagen PPM de la simulacion, un fotograma por fila
+ * -z N			pixels de la imagen por LED (por defecto 4)
+ *
+ * Formato del guion: una instruccion por linea, ';' empieza un comentario y
+ * "nombre:" pone una etiqueta para BUCLE y SALTO. Los numeros en decimal o
+ * 0x hexadecimal; los colores como #RRGGBB, 0xRRGGBB o con el nombre de los
+ * PIX_ basicos (negro, rojo, naranja, amarillo, verde, celeste, azul,
+ * fucsia, violeta, blanco).
+ *
+ * 	llenar desde, hasta, color	LlenarDeColor()
+ * 	pixel n, color				SetPixelColor()
+ * 	rueda desde, hasta, paso	LEDs con Wheel(fase + paso * i)
+ * 	brillo b					CambiarBrillo()
+ * 	esperar n					termina el fotograma, sigue n fotogramas despues
+ * 	fase d						fase += d (-128 a 255)
+ * 	contar c, n					contador c (0-3) = n vueltas (1-256)
+ * 	bucle c, etiqueta			si --contador c != 0 salta
+ * 	salto etiqueta				salta siempre
+ * 	efecto estela, a			FundirANegro(a) en cada fotograma
+ * 	efecto arcoiris, a, b		toda la tira con la rueda, fase += b
+ * 	efecto nada					quita el efecto
+ * 	fin							termina el guion
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "../led_pixels_guion_op.h"
+
+#define MAX_BYTES		65536	//direcciones de 16 bits
+#define MAX_LINEA		256
+#define MAX_ETIQUETAS	1024
+#define MAX_LEDS		4096
+#define MAX_OPS			100000	//instrucciones por fotograma antes de dar un bucle sin ESPERAR
+
+/*
+ * Operandos de cada instruccion, una letra por operando:
+ * L LED (2 bytes)		C color (3)			B byte 0-255
+ * S byte -128 a 255	F 1-256 (256 = 0)	K contador 0-3
+ * D etiqueta (2)		E efecto			b byte opcional (0)
+ */
+typedef struct{
+	const char *Nombre;
+	int Op;
+	const char *Args;
+}Instruccion;
+
+static const Instruccion Instrucciones[] = {
+	{"fin",		PIX_OP_FIN,		""},
+	{"llenar",	PIX_OP_LLENAR,	"LLC"},
+	{"pixel",	PIX_OP_PIXEL,	"LC"},
+	{"rueda",	PIX_OP_RUEDA,	"LLB"},
+	{"brillo",	PIX_OP_BRILLO,	"B"},
+	{"esperar",	PIX_OP_ESPERAR,	"F"},
+	{"fase",	PIX_OP_FASE,	"S"},
+	{"contar",	PIX_OP_CONTAR,	"KF"},
+	{"bucle",	PIX_OP_BUCLE,	"KD"},
+	{"salto",	PIX_OP_SALTO,	"D"},
+	{"efecto",	PIX_OP_EFECTO,	"Ebb"},
+};
+#define NUM_INSTRUCCIONES	(sizeof(Instrucciones) / sizeof(Instrucciones[0]))
+
+typedef struct{
+	const char *Nombre;
+	long Valor;
+}Constante;
+
+//Mismos valores que los colores basicos de led_pixels.h
+static const Constante Colores[] = {
+	{"negro", 0x000000}, {"rojo", 0xFF0000}, {"naranja", 0xFF6A00},
+	{"amarillo", 0x7D7D00}, {"verde", 0x00FF00}, {"celeste", 0x1284A5},
+	{"azul", 0x0000FF}, {"fucsia", 0xFF005A}, {"violeta", 0xAC00FF},
+	{"blanco", 0xFFFFFF},
+};
+#define NUM_COLORES		(sizeof(Colores) / sizeof(Colores[0]))
+
+static const Constante Efectos[] = {
+	{"nada", PIX_EF_NADA}, {"estela", PIX_EF_ESTELA}, {"arcoiris", PIX_EF_ARCOIRIS},
+};
+#define NUM_EFECTOS		(sizeof(Efectos) / sizeof(Efectos[0]))
+
+typedef struct{
+	char Nombre[MAX_LINEA];
+	long Dir;
+}Etiqueta;
+
+//Guion ensamblado
+static unsigned char Codigo[MAX_BYTES];
+static long Largo;
+static Etiqueta Etiquetas[MAX_ETIQUETAS];
+static int NumEtiquetas;
+
+//Una entrada por instruccion, para los comentarios del array y los avisos
+typedef struct{
+	long Dir;
+	int Linea;
+	char Texto[MAX_LINEA];
+}Fuente;
+
+static Fuente *Fuentes;
+static int NumFuentes;
+
+static const char *Archivo = "-";
+static int Errores;
+
+static void Error(int Linea, const char *Mensaje, const char *Que){
+	fprintf(stderr, "%s:%d: %s%s%s\n", Archivo, Linea, Mensaje, Que ? ": " : "", Que ? Que : "");
+	Errores++;
+}
+
+static char *Recortar(char *s){
+	char *f;
+
+	while(isspace((unsigned char)*s)) s++;
+	f = s + strlen(s);
+	while(f > s && isspace((unsigned char)f[-1])) f--;
+	*f = 0;
+	return s;
+}
+
+static int EsNombre(const char *s){
+	if(!isalpha((unsigned char)*s) && *s != '_') return 0;
+	for(; *s; s++)
+		if(!isalnum((unsigned char)*s) && *s != '_') return 0;
+	return 1;
+}
+
+static int Numero(const char *s, long *v){
+	char *f;
+
+	if(*s == 0) return 0;
+	if(s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) *v = strtol(s, &f, 16);
+	else *v = strtol(s, &f, 10);
+	return *f == 0;
+}
+
+static int Buscar(const Constante *t, int n, const char *s, long *v){
+	int i;
+
+	for(i = 0; i < n; i++){
+		if(strcasecmp(t[i].Nombre, s) == 0){
+			*v = t[i].Valor;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static int Color(const char *s, long *v){
+	char *f;
+
+	if(s[0] == '#'){
+		*v = strtol(s + 1, &f, 16);
+		return *f == 0 && strlen(s) == 7;
+	}
+	if(Buscar(Colores, NUM_COLORES, s, v)) return 1;
+	return Numero(s, v) && *v >= 0 && *v <= 0xFFFFFF;
+}
+
+static long BuscarEtiqueta(const char *s){
+	int i;
+
+	for(i = 0; i < NumEtiquetas; i++)
+		if(strcmp(Etiquetas[i].Nombre, s) == 0) return Etiquetas[i].Dir;
+	return -1;
+}
+
+static int Bytes(const char *Args){
+	int n = 1;
+
+	for(; *Args; Args++){
+		if(*Args == 'L' || *Args == 'D') n += 2;
+		else if(*Args == 'C') n += 3;
+		else n++;
+	}
+	return n;
+}
+
+static void Poner(int Linea, long v){
+	if(Largo >= MAX_BYTES){
+		if(Largo == MAX_BYTES) Error(Linea, "el guion no cabe en 64KB", NULL);
+		Largo = MAX_BYTES + 1;
+		return;
+	}
+	Codigo[Largo++] = (unsigned char)v;
+}
+
+/*
+ * Codifica un operando. Devuelve 0 si no es valido
+ */
+static int Operando(int Linea, char Tipo, const char *s){
+	long v;
+
+	switch(Tipo){
+		case 'L':
+			if(!Numero(s, &v) || v < 0 || v > 65535) return 0;
+			Poner(Linea, v & 0xFF);
+			Poner(Linea, v >> 8);
+			return 1;
+		case 'D':
+			v = BuscarEtiqueta(s);
+			if(v < 0){
+				Error(Linea, "etiqueta desconocida", s);
+				return 1;		//ya avisado
+			}
+			Poner(Linea, v & 0xFF);
+			Poner(Linea, v >> 8);
+			return 1;
+		case 'C':
+			if(!Color(s, &v)) return 0;
+			Poner(Linea, (v >> 16) & 0xFF);
+			Poner(Linea, (v >> 8) & 0xFF);
+			Poner(Linea, v & 0xFF);
+			return 1;
+		case 'S':
+			if(!Numero(s, &v) || v < -128 || v > 255) return 0;
+			break;
+		case 'F':
+			if(!Numero(s, &v) || v < 1 || v > 256) return 0;
+			break;
+		case 'K':
+			if(!Numero(s, &v) || v < 0 || v >= PIX_GUION_CONTADORES) return 0;
+			break;
+		case 'E':
+			if(!Buscar(Efectos, NUM_EFECTOS, s, &v)) return 0;
+			break;
+		default:	//B, b
+			if(!Numero(s, &v) || v < 0 || v > 255) return 0;
+			break;
+	}
+	Poner(Linea, v & 0xFF);
+	return 1;
+}
+
+/*
+ * Una linea del guion. En la primera pasada solo se apuntan las etiquetas y
+ * se avanza la direccion; en la segunda se codifica
+ */
+static void Ensamblar(char *Texto, int Linea, int Pasada){
+	char Copia[MAX_LINEA];
+	char *s, *p, *Args[8];
+	const Instruccion *In = NULL;
+	int i, n = 0;
+
+	s = strchr(Texto, ';');
+	if(s != NULL) *s = 0;
+	s = Recortar(Texto);
+	if(*s == 0) return;
+	snprintf(Copia, sizeof(Copia), "%s", s);
+
+	//etiqueta
+	p = strchr(s, ':');
+	if(p != NULL){
+		*p = 0;
+		if(!EsNombre(Recortar(s))){
+			if(Pasada == 1) Error(Linea, "etiqueta no valida", s);
+		}else if(Pasada == 1){
+			if(BuscarEtiqueta(Recortar(s)) >= 0) Error(Linea, "etiqueta repetida", s);
+			else if(NumEtiquetas == MAX_ETIQUETAS) Error(Linea, "demasiadas etiquetas", NULL);
+			else{
+				snprintf(Etiquetas[NumEtiquetas].Nombre, MAX_LINEA, "%s", Recortar(s));
+				Etiquetas[NumEtiquetas++].Dir = Largo;
+			}
+		}
+		s = Recortar(p + 1);
+		if(*s == 0) return;
+	}
+
+	//instruccion y operandos
+	p = s;
+	while(*p && !isspace((unsigned char)*p)) p++;
+	if(*p) *p++ = 0;
+	for(i = 0; i < (int)NUM_INSTRUCCIONES; i++)
+		if(strcasecmp(Instrucciones[i].Nombre, s) == 0) In = &Instrucciones[i];
+	if(In == NULL){
+		if(Pasada == 1) Error(Linea, "instruccion desconocida", s);
+		return;
+	}
+
+	p = Recortar(p);
+	if(*p){
+		for(s = strtok(p, ","); s != NULL && n < 8; s = strtok(NULL, ","))
+			Args[n++] = Recortar(s);
+	}
+
+	if(Pasada == 1){
+		Largo += Bytes(In->Args);
+		return;
+	}
+
+	Fuentes[NumFuentes].Dir = Largo;
+	Fuentes[NumFuentes].Linea = Linea;
+	snprintf(Fuentes[NumFuentes].Texto, MAX_LINEA, "%s", Copia);
+	NumFuentes++;
+
+	Poner(Linea, In->Op);
+	for(i = 0; In->Args[i]; i++){
+		if(i >= n){
+			if(In->Args[i] == 'b'){
+				Poner(Linea, 0);
+				continue;
+			}
+			Error(Linea, "faltan operandos", In->Nombre);
+			return;
+		}
+		if(!Operando(Linea, In->Args[i], Args[i])) Error(Linea, "operando no valido", Args[i]);
+	}
+	if(n > i) Error(Linea, "sobran operandos", In->Nombre);
+}
+
+/*
+ * Ensambla el archivo entero. Devuelve 0 si hay errores
+ */
+static int LeerGuion(FILE *f){
+	char **Lineas = NULL;
+	char Texto[MAX_LINEA];
+	int NumLineas = 0, i;
+
+	while(fgets(Texto, sizeof(Texto), f) != NULL){
+		char **l = realloc(Lineas, (NumLineas + 1) * sizeof(char *));
+		if(l == NULL) return 0;
+		Lineas = l;
+		Lineas[NumLineas] = strdup(Texto);
+		if(Lineas[NumLineas++] == NULL) return 0;
+	}
+
+	for(i = 0; i < NumLineas; i++){
+		snprintf(Texto, sizeof(Texto), "%s", Lineas[i]);
+		Ensamblar(Texto, i + 1, 1);
+	}
+	Fuentes = calloc(NumLineas + 1, sizeof(Fuente));
+	if(Fuentes == NULL) return 0;
+	Largo = 0;
+	for(i = 0; i < NumLineas; i++){
+		Ensamblar(Lineas[i], i + 1, 2);
+		free(Lineas[i]);
+	}
+	free(Lineas);
+
+	if(Largo == 0) Error(NumLineas, "el guion esta vacio", NULL);
+	else{
+		int Op = Codigo[Fuentes[NumFuentes - 1].Dir];
+		if(Op != PIX_OP_FIN && Op != PIX_OP_SALTO)
+			fprintf(stderr, "%s:%d: aviso: el guion no termina en fin ni salto\n", Archivo, Fuentes[NumFuentes - 1].Linea);
+	}
+	return Errores == 0;
+}
+
+static void EscribirArray(const char *Nombre){
+	int k, i;
+
+	printf("//%s: %ld bytes, generado con tools/pix_guion.c\n", Archivo, Largo);
+	printf("rom int %s[] = {\n", Nombre);
+	for(k = 0; k < NumFuentes; k++){
+		long Fin = (k + 1 < NumFuentes) ? Fuentes[k + 1].Dir : Largo;
+		int Col = 1;
+
+		printf("\t");
+		for(i = Fuentes[k].Dir; i < Fin; i++){
+			Col += printf("%s0x%02X", (i == Fuentes[k].Dir) ? "" : ", ", Codigo[i]);
+		}
+		if(Fin < Largo) Col += printf(",");
+		do{
+			printf("\t");
+			Col = (Col + 4) & ~3;
+		}while(Col < 48);
+		printf("//%s\n", Fuentes[k].Texto);
+	}
+	printf("};\n");
+}
+
+static void EscribirEeprom(long Dir){
+	long i;
+
+	printf("#rom int8 getenv(\"EEPROM_ADDRESS\") + %ld = {", Dir);
+	for(i = 0; i < Largo; i++) printf("%s%d", i ? ", " : "", Codigo[i]);
+	printf("}\n");
+}
+
+/* ------------------------------- SIMULADOR ---------------------------------
+ * Las mismas cuentas que la libreria sobre un buffer RGB (el orden de los
+ * bytes no cambia nada). Brillo guarda el valor como la variable Brillo del
+ * PIC: 0 = maximo, si no el factor es Brillo / 256
+ */
+static unsigned char Pix[MAX_LEDS * 3];
+static int Leds = 60;
+static int Brillo = 0;
+
+static void SimPixel(long n, int r, int g, int b){
+	unsigned char *p;
+
+	if(n < 0 || n >= Leds) return;
+	if(Brillo != 0){
+		r = (r * Brillo) >> 8;
+		g = (g * Brillo) >> 8;
+		b = (b * Brillo) >> 8;
+	}
+	p = Pix + n * 3;
+	p[0] = r;
+	p[1] = g;
+	p[2] = b;
+}
+
+static void SimWheel(int Pos, int *r, int *g, int *b){
+	Pos &= 0xFF;
+	if(Pos < 85){
+		*r = 255 - Pos * 3; *g = Pos * 3; *b = 0;
+	}else if(Pos < 170){
+		Pos -= 85;
+		*r = 0; *g = 255 - Pos * 3; *b = Pos * 3;
+	}else{
+		Pos -= 170;
+		*r = Pos * 3; *g = 0; *b = 255 - Pos * 3;
+	}
+}
+
+static void SimRueda(long Desde, long Hasta, int Fase, int Paso){
+	int r, g, b;
+
+	for(; Desde <= Hasta && Desde < Leds; Desde++){
+		SimWheel(Fase, &r, &g, &b);
+		SimPixel(Desde, r, g, b);
+		Fase += Paso;
+	}
+}
+
+/*
+ * CambiarBrillo(): escala el buffer por Nuevo/Anterior (0 = 256), redondeando
+ * y saturando. En el PIC la escala va en 8.16 y puede diferir en 1
+ */
+static void SimBrillo(int b){
+	int Nuevo = (b + 1) & 0xFF;
+	int i;
+
+	if(Nuevo == Brillo) return;
+	for(i = 0; i < Leds * 3; i++){
+		int v;
+		if(Brillo == 0) v = (Pix[i] * Nuevo) >> 8;
+		else if(Brillo == 1) v = 0;
+		else v = (Pix[i] * (Nuevo ? Nuevo : 256) + Brillo / 2) / Brillo;
+		Pix[i] = (v > 255) ? 255 : v;
+	}
+	Brillo = Nuevo;
+}
+
+static void SimFundir(int Cantidad){
+	int i;
+
+	if(Cantidad == 0) return;
+	for(i = 0; i < Leds * 3; i++) Pix[i] = (Pix[i] * (256 - Cantidad)) >> 8;
+}
+
+static int Linea(long Dir){
+	int k;
+
+	for(k = NumFuentes - 1; k > 0; k--)
+		if(Fuentes[k].Dir <= Dir) break;
+	return Fuentes[k].Linea;
+}
+
+//Estado de PasoGuion()
+static long Pc;
+static int Espera = 1, Fase, Efecto, EfA, EfB, Activo = 1;
+static int Cont[PIX_GUION_CONTADORES];
+static int FueraAvisado;
+
+static int Leer(void){
+	return (Pc < Largo) ? Codigo[Pc++] : (Pc++, PIX_OP_FIN);
+}
+
+static long Leer16(void){
+	long l = Leer();
+	return l | ((long)Leer() << 8);
+}
+
+static void Fuera(long Dir, long n){
+	if(n < Leds || FueraAvisado) return;
+	fprintf(stderr, "%s:%d: aviso: LED %ld fuera de la tira (%d LEDs)\n", Archivo, Linea(Dir), n, Leds);
+	FueraAvisado = 1;
+}
+
+/*
+ * Igual que PasoGuion(). Devuelve 0 al terminar y -1 si no llega a ESPERAR
+ */
+static int SimPaso(void){
+	long Ops = 0, Dir, Desde, Hasta;
+	int Op, r, g, b;
+
+	if(!Activo) return 0;
+
+	if(Efecto == PIX_EF_ESTELA) SimFundir(EfA);
+	else if(Efecto == PIX_EF_ARCOIRIS){
+		SimRueda(0, Leds - 1, Fase, EfA);
+		Fase = (Fase + EfB) & 0xFF;
+	}
+
+	Espera = (Espera - 1) & 0xFF;
+	if(Espera != 0) return 1;
+
+	while(1){
+		if(++Ops > MAX_OPS){
+			fprintf(stderr, "%s:%d: el fotograma no llega a ESPERAR\n", Archivo, Linea(Pc));
+			return -1;
+		}
+		Dir = Pc;
+		Op = Leer();
+
+		switch(Op){
+			case PIX_OP_LLENAR:
+				Desde = Leer16();
+				Hasta = Leer16();
+				r = Leer(); g = Leer(); b = Leer();
+				Fuera(Dir, Hasta);
+				for(; Desde <= Hasta && Desde < Leds; Desde++) SimPixel(Desde, r, g, b);
+				break;
+			case PIX_OP_PIXEL:
+				Desde = Leer16();
+				r = Leer(); g = Leer(); b = Leer();
+				Fuera(Dir, Desde);
+				SimPixel(Desde, r, g, b);
+				break;
+			case PIX_OP_RUEDA:
+				Desde = Leer16();
+				Hasta = Leer16();
+				Fuera(Dir, Hasta);
+				SimRueda(Desde, Hasta, Fase, Leer());
+				break;
+			case PIX_OP_BRILLO:
+				SimBrillo(Leer());
+				break;
+			case PIX_OP_ESPERAR:
+				Espera = Leer();
+				return 1;
+			case PIX_OP_FASE:
+				Fase = (Fase + Leer()) & 0xFF;
+				break;
+			case PIX_OP_CONTAR:
+				r = Leer() & (PIX_GUION_CONTADORES - 1);
+				Cont[r] = Leer();
+				break;
+			case PIX_OP_BUCLE:
+				r = Leer() & (PIX_GUION_CONTADORES - 1);
+				Desde = Leer16();
+				Cont[r] = (Cont[r] - 1) & 0xFF;
+				if(Cont[r] != 0) Pc = Desde;
+				break;
+			case PIX_OP_SALTO:
+				Pc = Leer16();
+				break;
+			case PIX_OP_EFECTO:
+				Efecto = Leer();
+				EfA = Leer();
+				EfB = Leer();
+				break;
+			default:
+				Activo = 0;
+				return 1;
+		}
+	}
+}
+
+static int Simular(long Tramas, double Fps, const char *Imagen, int Zoom){
+	FILE *f = NULL;
+	long t, Fin = 0;
+	int n, i, k, Estado = 1;
+
+	if(Imagen != NULL){
+		f = fopen(Imagen, "wb");
+		if(f == NULL){
+			fprintf(stderr, "No se puede crear %s\n", Imagen);
+			return 1;
+		}
+		fprintf(f, "P6\n%d %ld\n255\n", Leds * Zoom, Tramas * Zoom);
+	}
+
+	printf("trama,ms,leds,bits_sueltos,colores...\n");
+	for(t = 0; t < Tramas; t++){
+		if(Estado == 1) Estado = SimPaso();
+		if(Estado < 0) break;
+		if(!Activo && Fin == 0) Fin = t + 1;	//fotograma de FIN
+
+		printf("%ld,%.3f,%d,0", t + 1, t * 1000.0 / Fps, Leds);
+		for(n = 0; n < Leds; n++) printf(",%02X%02X%02X", Pix[n * 3], Pix[n * 3 + 1], Pix[n * 3 + 2]);
+		printf("\n");
+
+		if(f != NULL){
+			for(k = 0; k < Zoom; k++)
+				for(n = 0; n < Leds; n++)
+					for(i = 0; i < Zoom; i++) fwrite(Pix + n * 3, 1, 3, f);
+		}
+	}
+
+	if(f != NULL) fclose(f);
+	if(Estado < 0) return 1;
+	if(Fin != 0) fprintf(stderr, "%s: el guion termina en el fotograma %ld\n", Archivo, Fin);
+	return 0;
+}
+
+static void Ayuda(void){
+	printf("Uso: pix_guion -f guion.txt [-n nombre | -e dir | -b archivo]\n");
+	printf("     pix_guion -f guion.txt -s fotogramas [-l leds] [-r fps] [-p imagen.ppm] [-z zoom]\n");
+}
+
+int main(int argc, char *argv[]){
+	const char *Nombre = "Guion", *Binario = NULL, *Imagen = NULL;
+	long Eeprom = -1, Tramas = 0;
+	double Fps = 50;
+	int Zoom = 4, i;
+	FILE *f = stdin;
+
+	for(i = 1; i < argc; i++){
+		const char *op = argv[i];
+		const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if(v == NULL){ Ayuda(); return 2; }
+		i++;
+
+		if(strcmp(op, "-f") == 0) Archivo = v;
+		else if(strcmp(op, "-n") == 0) Nombre = v;
+		else if(strcmp(op, "-e") == 0) Eeprom = atol(v);
+		else if(strcmp(op, "-b") == 0) Binario = v;
+		else if(strcmp(op, "-s") == 0) Tramas = atol(v);
+		else if(strcmp(op, "-l") == 0) Leds = atoi(v);
+		else if(strcmp(op, "-r") == 0) Fps = atof(v);
+		else if(strcmp(op, "-p") == 0) Imagen = v;
+		else if(strcmp(op, "-z") == 0) Zoom = atoi(v);
+		else{
+			Ayuda();
+			return 2;
+		}
+	}
+	if(argc < 2 || Leds < 1 || Leds > MAX_LEDS || Fps <= 0 || Zoom < 1 || Tramas < 0 || !EsNombre(Nombre)){
+		Ayuda();
+		return 2;
+	}
+
+	if(strcmp(Archivo, "-") != 0){
+		f = fopen(Archivo, "r");
+		if(f == NULL){
+			fprintf(stderr, "No se puede abrir %s\n", Archivo);
+			return 1;
+		}
+	}
+	i = LeerGuion(f);
+	if(f != stdin) fclose(f);
+	if(!i) return 1;
+
+	if(Binario != NULL){
+		f = fopen(Binario, "wb");
+		if(f == NULL || fwrite(Codigo, 1, Largo, f) != (size_t)Largo){
+			fprintf(stderr, "No se puede escribir %s\n", Binario);
+			return 1;
+		}
+		fclose(f);
+	}
+
+	if(Tramas > 0) return Simular(Tramas, Fps, Imagen, Zoom);
+	if(Eeprom >= 0) EscribirEeprom(Eeprom);
+	else if(Binario == NULL) EscribirArray(Nombre);
+	return 0;
+}
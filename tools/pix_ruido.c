@@ -0,0 +1,279 @@
+/*
+ * File:   pix_ruido.c
+ * Author: Martin
+ *
+ * Created on 19 de octubre de 2026
+ */
+
+/* ------------------------------- INFORMACION --------------------------------
+ * Prueba en el PC del ruido de led_pixels_ruido.c y presupuesto de ciclos
+ *
+ * Programa para el PC (no para el PIC). Lee PixPerm[] y PixSuave[] de
+ * led_pixels_ruido.c (las mismas tablas que compila el PIC, no una copia),
+ * repite en el PC la aritmetica de 8 bits de Ruido8XY() y del recorrido
+ * incremental de RuidoLinea() (PixRuidoIniciar/PixRuidoSiguiente) y
+ * comprueba:
+ *
+ * -PixPerm[] es una permutacion de 0-255
+ * -PixSuave[k] = 255 * (3t^2 - 2t^3) redondeado, con t = k/255, y no baja
+ * -RuidoLinea() da exactamente lo mismo que Ruido8XY() pixel a pixel, para
+ *  lineas con pasos de 0 a 1024 (saltos de varias celdas), y que la
+ *  coordenada x da la vuelta a los 16 bits
+ *
+ * Ademas cuenta lo que hace cada pixel con el paso -p (mezclas, lecturas de
+ * tabla, cambios de celda) y con los ciclos de PIC16 de cada operacion calcula los ciclos
+ * por pixel, que compara con lo que deja una tira de -n LEDs a -r fotogramas
+ * por segundo con un reloj de -m MHz (descontado el envio a 800KHz). Los
+ * ciclos de Mezclar8() son los de la tabla de led_pixels.c (Escalar8 lo mide
+ * pix_escalar); el resto son las instrucciones que genera CCS para cada
+ * paso. La cifra real en la placa la da la fila RuidoLinea de bench.c.
+ *
+ * Si algo no coincide, o el ruido no cabe en el fotograma, devuelve 1.
+ *
+ * Compilar:	gcc -O2 -o pix_ruido pix_ruido.c -lm
+ *
+ * Uso:
+ * pix_ruido
+ * pix_ruido -f ../led_pixels_ruido.c -n 85 -r 30 -m 32
+ *
+ * Opciones:
+ * -f archivo	led_pixels_ruido.c de donde leer las tablas (por defecto
+ *				../led_pixels_ruido.c)
+ * -n LEDs		LEDs de la tira (por defecto 85)
+ * -r FPS		fotogramas por segundo (por defecto 30)
+ * -m MHz		reloj del PIC (por defecto 32, el de bench.c)
+ * -p paso		avance en x por LED (8.8) para la media de ciclos (por defecto
+ *				40, el del ejemplo de led_pixels_ruido.h y de bench.c)
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+//Ciclos de PIC16 de cada operacion, con la llamada
+#define CICLOS_MEZCLAR		(45 + 8)	//Mezclar8 (led_pixels.c) + 3 parametros, CALL y RETURN
+#define CICLOS_TABLA		12			//lectura de un const int[256] en ROM (RETLW)
+#define CICLOS_PIXEL		40			//resto de PixRuidoSiguiente y del bucle de RuidoLinea
+#define CICLOS_CELDA		20			//comprobar el cambio de celda y llamar a PixColumna
+
+static uint8_t PixPerm[256], PixSuave[256];
+
+//Lo que ha hecho el modelo
+static long Mezclas, Tablas, Celdas;
+
+/*
+ * Busca "(Nombre)[256] = {" en el archivo y lee los 256 valores, saltando
+ * los comentarios //. Devuelve 0 si no la encuentra o esta incompleta
+ */
+static int LeerTabla(const char *Archivo, const char *Nombre, uint8_t *t){
+	FILE *f = fopen(Archivo, "r");
+	char Linea[512], Firma[64];
+	int Dentro = 0, n = 0;
+
+	if(f == NULL) return 0;
+	snprintf(Firma, sizeof(Firma), "%s[256]", Nombre);
+
+	while(n < 256 && fgets(Linea, sizeof(Linea), f) != NULL){
+		char *p = Linea, *c;
+
+		if(!Dentro){
+			p = strstr(Linea, Firma);
+			if(p == NULL || (p = strchr(p, '{')) == NULL) continue;
+			Dentro = 1;
+			p++;
+		}
+		if((c = strstr(p, "//")) != NULL) *c = 0;
+
+		while(*p && n < 256){
+			if(*p >= '0' && *p <= '9'){
+				t[n++] = (uint8_t)strtoul(p, &p, 10);
+			}else if(*p == '}'){
+				break;
+			}else{
+				p++;
+			}
+		}
+	}
+	fclose(f);
+	return n == 256;
+}
+
+/*
+ * Mezclar8() de led_pixels.c: a + (b - a) * t / 256 con Escalar8()
+ */
+static uint8_t Mezclar8(uint8_t a, uint8_t b, uint8_t t){
+	Mezclas++;
+	if(b >= a) return (uint8_t)(a + (((b - a) * t) >> 8));
+	return (uint8_t)(a - (((a - b) * t) >> 8));
+}
+
+static uint8_t Perm(uint8_t k){ Tablas++; return PixPerm[k]; }
+static uint8_t Suave(uint8_t k){ Tablas++; return PixSuave[k]; }
+
+/*
+ * El resto con los tipos del PIC: int = uint8_t, long = uint16_t
+ */
+static uint8_t PixEsquina(uint8_t x, uint8_t y){
+	return Perm((uint8_t)(Perm(x) + y));
+}
+
+static uint8_t PixColumna(uint8_t x, uint8_t y, uint8_t Ey){
+	return Mezclar8(PixEsquina(x, y), PixEsquina(x, (uint8_t)(y + 1)), Ey);
+}
+
+static uint8_t Ruido8XY(uint16_t x, uint16_t y){
+	uint8_t c = (uint8_t)(x >> 8), Ey = Suave((uint8_t)y);
+
+	return Mezclar8(PixColumna(c, (uint8_t)(y >> 8), Ey),
+		PixColumna((uint8_t)(c + 1), (uint8_t)(y >> 8), Ey), Suave((uint8_t)x));
+}
+
+typedef struct{
+	uint16_t x, Paso;
+	uint8_t y, Ey, c0, c1;
+}PixRuidoLinea;
+
+static void PixRuidoIniciar(PixRuidoLinea *r, uint16_t x, uint16_t Paso, uint16_t y){
+	r->x = x;
+	r->Paso = Paso;
+	r->y = (uint8_t)(y >> 8);
+	r->Ey = Suave((uint8_t)y);
+	r->c0 = PixColumna((uint8_t)(x >> 8), r->y, r->Ey);
+	r->c1 = PixColumna((uint8_t)((x >> 8) + 1), r->y, r->Ey);
+}
+
+static uint8_t PixRuidoSiguiente(PixRuidoLinea *r){
+	uint8_t v, Celda;
+
+	v = Mezclar8(r->c0, r->c1, Suave((uint8_t)r->x));
+
+	Celda = (uint8_t)(r->x >> 8);
+	r->x = (uint16_t)(r->x + r->Paso);
+	if((uint8_t)(r->x >> 8) != Celda){
+		Celdas++;
+		Celda++;
+		if((uint8_t)(r->x >> 8) == Celda){
+			r->c0 = r->c1;
+		}else{
+			Celda = (uint8_t)(r->x >> 8);
+			r->c0 = PixColumna(Celda, r->y, r->Ey);
+		}
+		r->c1 = PixColumna((uint8_t)(Celda + 1), r->y, r->Ey);
+	}
+
+	return v;
+}
+
+static void Ayuda(void){
+	fprintf(stderr, "Uso: pix_ruido [-f led_pixels_ruido.c] [-n LEDs] [-r FPS] [-m MHz] [-p paso]\n");
+}
+
+int main(int argc, char *argv[]){
+	const char *Archivo = "../led_pixels_ruido.c";
+	int Leds = 85, Fps = 30, MHz = 32, PasoMedida = 40;
+	int MalTabla = 0, Fallos = 0, Visto[256] = {0};
+	long Pixels = 0, Lineas = 0;
+	double Ciclos, PeorCiclos, Fotograma, Envio, Libres;
+	int i, k;
+	unsigned Paso, x, y;
+
+	for(i = 1; i < argc; i++){
+		if(i + 1 >= argc){ Ayuda(); return 2; }
+		if(strcmp(argv[i], "-f") == 0) Archivo = argv[++i];
+		else if(strcmp(argv[i], "-n") == 0) Leds = atoi(argv[++i]);
+		else if(strcmp(argv[i], "-r") == 0) Fps = atoi(argv[++i]);
+		else if(strcmp(argv[i], "-m") == 0) MHz = atoi(argv[++i]);
+		else if(strcmp(argv[i], "-p") == 0) PasoMedida = atoi(argv[++i]);
+		else{ Ayuda(); return 2; }
+	}
+	if(Leds <= 0 || Fps <= 0 || MHz <= 0 || PasoMedida < 0 || PasoMedida > 65535){ Ayuda(); return 2; }
+
+	if(!LeerTabla(Archivo, "PixPerm", PixPerm) || !LeerTabla(Archivo, "PixSuave", PixSuave)){
+		fprintf(stderr, "No se encuentran PixPerm[256] y PixSuave[256] completas en %s\n", Archivo);
+		return 1;
+	}
+
+	//las tablas
+	for(k = 0; k < 256; k++) Visto[PixPerm[k]]++;
+	for(k = 0; k < 256; k++){
+		double t = k / 255.0;
+		int Ideal = (int)floor(255 * (3 * t * t - 2 * t * t * t) + 0.5);
+
+		if(Visto[k] != 1){
+			printf("PixPerm[] tiene %d veces el %d\n", Visto[k], k);
+			MalTabla++;
+		}
+		if(PixSuave[k] != Ideal){
+			printf("PixSuave[%d] = %u, tiene que ser %d\n", k, PixSuave[k], Ideal);
+			MalTabla++;
+		}
+		if(k > 0 && PixSuave[k] < PixSuave[k - 1]){
+			printf("PixSuave[%d] baja\n", k);
+			MalTabla++;
+		}
+	}
+
+	//cada linea contra Ruido8XY() punto a punto
+	for(Paso = 0; Paso <= 1024; Paso += (Paso < 64) ? 1 : 13){
+		for(y = 0; y < 65536; y += 4099){
+			for(x = 0; x < 65536; x += 7919){
+				PixRuidoLinea r;
+
+				PixRuidoIniciar(&r, (uint16_t)x, (uint16_t)Paso, (uint16_t)y);
+				for(k = 0; k < Leds; k++){
+					uint16_t Px = (uint16_t)(x + Paso * (unsigned)k);
+					uint8_t v = PixRuidoSiguiente(&r), Punto = Ruido8XY(Px, (uint16_t)y);
+
+					if(v != Punto){
+						if(Fallos < 10)
+							printf("x %u paso %u y %u pixel %d: %u, Ruido8XY da %u\n",
+								x, Paso, y, k, v, Punto);
+						Fallos++;
+					}
+				}
+				Lineas++;
+			}
+		}
+	}
+
+	Mezclas = Tablas = Celdas = 0;
+
+	//lo que hace cada pixel con el paso pedido. PixRuidoIniciar() es una vez
+	//por linea y no se cuenta
+	for(y = 0; y < 65536; y += 4099){
+		for(x = 0; x < 65536; x += 7919){
+			PixRuidoLinea r;
+			long m = Mezclas, t = Tablas;
+
+			PixRuidoIniciar(&r, (uint16_t)x, (uint16_t)PasoMedida, (uint16_t)y);
+			Mezclas = m;
+			Tablas = t;
+			for(k = 0; k < Leds; k++) PixRuidoSiguiente(&r);
+			Pixels += Leds;
+		}
+	}
+
+	//ciclos: media con ese paso y peor caso (cambio de celda sin lado que
+	//reutilizar en cada pixel, paso >= 512: tres mezclas y nueve lecturas)
+	Ciclos = (Mezclas * (double)CICLOS_MEZCLAR + Tablas * (double)CICLOS_TABLA
+		+ Celdas * (double)CICLOS_CELDA) / Pixels + CICLOS_PIXEL;
+	PeorCiclos = 3 * CICLOS_MEZCLAR + 9 * CICLOS_TABLA + CICLOS_CELDA + CICLOS_PIXEL;
+
+	Fotograma = MHz * 1e6 / 4 / Fps;
+	Envio = (Leds * 24 * 1.25 + 50) * MHz / 4;	//800KHz mas el reset, en ciclos
+	Libres = (Fotograma - Envio) / Leds;
+
+	printf("Tablas PixPerm y PixSuave: %s\n", MalTabla ? "MAL" : "bien");
+	printf("Lineas: %ld de %d LEDs, distintas de Ruido8XY: %d\n", Lineas, Leds, Fallos);
+	printf("Por pixel con paso %d: %.3f mezclas, %.3f lecturas de tabla, %.3f cambios de celda\n",
+		PasoMedida, (double)Mezclas / Pixels, (double)Tablas / Pixels, (double)Celdas / Pixels);
+	printf("Ciclos por pixel (PIC16): %.0f con paso %d, %.0f en el peor caso\n", Ciclos, PasoMedida, PeorCiclos);
+	printf("%d LEDs a %d FPS con %d MHz: %.0f ciclos por fotograma, %.0f de envio, %.0f libres por pixel\n",
+		Leds, Fps, MHz, Fotograma, Envio, Libres);
+	printf("El ruido usa el %.1f%% (peor caso %.1f%%) de lo que queda libre\n",
+		100 * Ciclos / Libres, 100 * PeorCiclos / Libres);
+
+	return (MalTabla || Fallos || PeorCiclos > Libres) ? 1 : 0;
+}